@@ -0,0 +1,67 @@
+/* allocation_counter.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Replaces the global operator new so that benchmarks can count
+ * heap allocations.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_BENCHMARK_ALLOCATIONCOUNTER_H_
+#define CENTRALISEDAI_BENCHMARK_ALLOCATIONCOUNTER_H_
+
+/* C++ standard library headers */
+#include "atomic"
+#include "cstdint"
+#include "cstdlib"
+#include "new"
+
+/* The replacement operators below are not inline, so this header must only
+ * be included by the one source file of a benchmark executable. */
+
+namespace centralised_ai
+{
+namespace benchmark
+{
+
+/*!
+ * @brief Number of heap allocations made by the process so far.
+ */
+std::atomic<int64_t> allocation_count(0);
+
+/*!
+ * @brief Returns the number of heap allocations made by the process so far.
+ */
+int64_t GetAllocationCount()
+{
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+} /* namespace benchmark */
+} /* namespace centralised_ai */
+
+void* operator new(std::size_t size)
+{
+  centralised_ai::benchmark::allocation_count.fetch_add(
+      1, std::memory_order_relaxed);
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+#endif /* CENTRALISEDAI_BENCHMARK_ALLOCATIONCOUNTER_H_ */
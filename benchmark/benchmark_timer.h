@@ -0,0 +1,116 @@
+/* benchmark_timer.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Small timing helpers shared by the benchmark executables.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_BENCHMARK_BENCHMARKTIMER_H_
+#define CENTRALISEDAI_BENCHMARK_BENCHMARKTIMER_H_
+
+/* C++ standard library headers */
+#include "algorithm"
+#include "chrono"
+#include "cstdio"
+#include "string"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace benchmark
+{
+
+/*!
+ * @brief Summary of repeated measurements of the same piece of code.
+ */
+struct BenchmarkResult
+{
+  /*!
+   * @brief Mean wall time per call in microseconds.
+   */
+  double mean_us;
+
+  /*!
+   * @brief Median wall time per call in microseconds.
+   */
+  double median_us;
+
+  /*!
+   * @brief Slowest call in microseconds.
+   */
+  double max_us;
+};
+
+/*!
+ * @brief Runs a function a number of times and measures the wall time of each
+ * call.
+ *
+ * @param[in] function The function to measure.
+ *
+ * @param[in] iterations Number of measured calls.
+ *
+ * @param[in] warmup_iterations Number of calls made before measuring, used to
+ * fill caches and let allocators settle.
+ *
+ * @return The summary of the measured calls.
+ */
+template <typename Function>
+BenchmarkResult Measure(Function&& function, int iterations,
+    int warmup_iterations = 1)
+{
+  std::vector<double> samples;
+  samples.reserve(iterations);
+
+  for (int i = 0; i < warmup_iterations; i++)
+  {
+    function();
+  }
+
+  for (int i = 0; i < iterations; i++)
+  {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    auto end = std::chrono::steady_clock::now();
+    samples.push_back(
+        std::chrono::duration<double, std::micro>(end - start).count());
+  }
+
+  BenchmarkResult result = {0.0, 0.0, 0.0};
+  if (samples.empty())
+  {
+    return result;
+  }
+
+  for (double sample : samples)
+  {
+    result.mean_us += sample;
+  }
+  result.mean_us /= samples.size();
+
+  std::sort(samples.begin(), samples.end());
+  result.median_us = samples[samples.size() / 2];
+  result.max_us = samples.back();
+
+  return result;
+}
+
+/*!
+ * @brief Prints one row of a benchmark table.
+ *
+ * @param[in] name Name of the measured case.
+ *
+ * @param[in] result The measurement of the case.
+ */
+inline void PrintResult(const std::string& name, const BenchmarkResult& result)
+{
+  printf("%-48s mean=%12.2f us  median=%12.2f us  max=%12.2f us\n",
+      name.c_str(), result.mean_us, result.median_us, result.max_us);
+}
+
+} /* namespace benchmark */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_BENCHMARK_BENCHMARKTIMER_H_ */
@@ -0,0 +1,100 @@
+/* dynamic_quantization_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Compares the per time step latency of the float policy and
+ * critic against their dynamically quantized int8 copies, as used while
+ * collecting rollouts, and prints how often the two policies agree.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C++ standard library headers */
+#include "cstdio"
+#include "tuple"
+
+/* Other .h files */
+#include "torch/torch.h"
+
+/* Project .h files */
+#include "../../src/collective-robot-behaviour/dynamic_quantization.h"
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/policy_runner.h"
+#include "../../src/common_types.h"
+#include "../benchmark_timer.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Measures both policies and both critics for one number of environments. */
+static void RunBenchmark(int64_t num_environments) {
+  const int kIterations = 10000;
+  int64_t num_agents = num_environments * amount_of_players_in_team;
+
+  PolicyNetwork policy = CreatePolicy();
+  CriticNetwork critic;
+  DynamicQuantizedPolicy quantized_policy(policy);
+  DynamicQuantizedCritic quantized_critic(critic);
+  torch::Tensor local_states = torch::randn({num_agents, num_local_states});
+  torch::Tensor global_states =
+      torch::randn({num_environments, num_global_states});
+
+  printf("--- %ld agents ---\n", static_cast<long>(num_agents));
+
+  PolicyRunner runner(policy, num_agents);
+  benchmark::PrintResult("PolicyRunner::Act (float)", benchmark::Measure([&]() {
+                           runner.Act(local_states);
+                         }, kIterations, 100));
+
+  PolicyRunner quantized_runner(quantized_policy, num_agents);
+  benchmark::PrintResult("PolicyRunner::Act (int8)", benchmark::Measure([&]() {
+                           quantized_runner.Act(local_states);
+                         }, kIterations, 100));
+
+  torch::NoGradGuard no_grad;
+  torch::Tensor critic_hidden_states =
+      torch::zeros({1, num_environments, hidden_size});
+  benchmark::PrintResult(
+      "CriticNetwork::Forward (float)", benchmark::Measure([&]() {
+        critic_hidden_states = std::get<1>(critic.Forward(
+            global_states.unsqueeze(0), critic_hidden_states));
+      }, kIterations, 100));
+
+  torch::Tensor quantized_critic_hidden_states =
+      torch::zeros({num_environments, hidden_size});
+  benchmark::PrintResult(
+      "DynamicQuantizedCritic::Forward (int8)", benchmark::Measure([&]() {
+        quantized_critic_hidden_states = std::get<1>(quantized_critic.Forward(
+            global_states, quantized_critic_hidden_states));
+      }, kIterations, 100));
+
+  /* Agreement over a sequence of fresh states, from zero hidden states */
+  PolicyRunner float_runner(policy, num_agents);
+  PolicyRunner int8_runner(quantized_policy, num_agents);
+  double agreement = 0;
+  const int kTimeSteps = 100;
+  for (int t = 0; t < kTimeSteps; t++) {
+    torch::Tensor states = 2 * torch::randn({num_agents, num_local_states});
+    torch::Tensor float_actions = std::get<0>(float_runner.Act(states)).clone();
+    torch::Tensor int8_actions = std::get<0>(int8_runner.Act(states));
+    agreement +=
+        float_actions.eq(int8_actions).to(torch::kDouble).mean().item<double>();
+  }
+  printf("Action agreement: %.4f\n", agreement / kTimeSteps);
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+int main() {
+  torch::manual_seed(0);
+
+  /* One environment, and 16 environments stepped together */
+  centralised_ai::collective_robot_behaviour::RunBenchmark(1);
+  centralised_ai::collective_robot_behaviour::RunBenchmark(16);
+
+  return 0;
+}
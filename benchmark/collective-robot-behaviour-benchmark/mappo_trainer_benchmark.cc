@@ -0,0 +1,72 @@
+/* mappo_trainer_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Measures the wall time of a MappoTrainer update in the release
+ * and debug training modes, and in release mode with bfloat16 precision.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C++ standard library headers */
+#include "cstdio"
+#include "string"
+
+/* Other .h files */
+#include "torch/torch.h"
+
+/* Project .h files */
+#include "../../src/collective-robot-behaviour/mappo_trainer.h"
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/rollout_storage.h"
+#include "../../src/common_types.h"
+#include "../../test/collective-robot-behaviour-test/random_rollout.h"
+#include "../benchmark_timer.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Measures one pass with a single mini batch, so all modes take the same
+ * number of optimizer steps */
+static void RunBenchmark(const RolloutStorage& kRollout, TrainingMode mode,
+                         TrainingPrecision precision,
+                         const std::string& kName) {
+  PolicyNetwork policy = CreatePolicy();
+  CriticNetwork critic;
+  MappoTrainer trainer(policy, critic, 1, 1, 0.0);
+  trainer.SetTrainingMode(mode);
+  trainer.SetTrainingPrecision(precision);
+
+  benchmark::PrintResult(kName, benchmark::Measure(
+                                    [&]() { trainer.Update(kRollout); }, 10));
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+int main() {
+  using centralised_ai::collective_robot_behaviour::TrainingMode;
+  using centralised_ai::collective_robot_behaviour::TrainingPrecision;
+
+  torch::manual_seed(0);
+  centralised_ai::collective_robot_behaviour::RolloutStorage rollout =
+      centralised_ai::collective_robot_behaviour::CreateRandomRollout(
+          centralised_ai::batch_size, centralised_ai::max_timesteps - 1);
+
+  printf("--- %ld chunks of %d time steps ---\n",
+         static_cast<long>(rollout.NumChunks()), centralised_ai::chunk_length);
+  centralised_ai::collective_robot_behaviour::RunBenchmark(
+      rollout, TrainingMode::kDebug, TrainingPrecision::kFloat32,
+      "MappoTrainer::Update (debug)");
+  centralised_ai::collective_robot_behaviour::RunBenchmark(
+      rollout, TrainingMode::kRelease, TrainingPrecision::kFloat32,
+      "MappoTrainer::Update (release)");
+  centralised_ai::collective_robot_behaviour::RunBenchmark(
+      rollout, TrainingMode::kRelease, TrainingPrecision::kBFloat16,
+      "MappoTrainer::Update (release, bfloat16)");
+
+  return 0;
+}
@@ -0,0 +1,43 @@
+/* phase_timer_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Measures the overhead of a timed phase, and of collecting the
+ * statistics of an epoch.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* Project .h files */
+#include "../../src/collective-robot-behaviour/phase_timer.h"
+#include "../benchmark_timer.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Measures a timed scope against an empty one, and the merge of the
+ * histograms of all threads at the end of an epoch. */
+static void RunBenchmark() {
+  const int kIterations = 1000000;
+
+  benchmark::PrintResult("Empty scope", benchmark::Measure([]() {}, kIterations,
+                                                           1000));
+  benchmark::PrintResult("Timed scope", benchmark::Measure([]() {
+                           CENTRALISEDAI_TIME_PHASE(Phase::kPolicyForward);
+                         }, kIterations, 1000));
+  benchmark::PrintResult("CollectPhaseStatistics", benchmark::Measure([]() {
+                           CollectPhaseStatistics();
+                         }, 1000, 10));
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+int main() {
+  centralised_ai::collective_robot_behaviour::RunBenchmark();
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+/* policy_engine_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Compares the per robot latency of one policy time step with
+ * PolicyEngine against PolicyNetwork::Forward with autograd disabled.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C++ standard library headers */
+#include "cstdio"
+#include "filesystem"
+#include "string"
+#include "tuple"
+
+/* Other .h files */
+#include "torch/torch.h"
+
+/* Project .h files */
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/policy_engine.h"
+#include "../../src/collective-robot-behaviour/policy_export.h"
+#include "../../src/common_types.h"
+#include "../benchmark_timer.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Measures one time step of one robot on both paths. */
+static void RunBenchmark() {
+  const int kIterations = 100000;
+
+  PolicyNetwork policy = CreatePolicy();
+  std::string path =
+      (std::filesystem::temp_directory_path() / "policy_engine_benchmark.bin")
+          .string();
+  ExportPolicyWeights(policy, path);
+  DefaultPolicyEngine engine = DefaultPolicyEngine::Load(path);
+  std::filesystem::remove(path);
+
+#if defined(CENTRALISEDAI_POLICYENGINE_AVX2)
+  printf("PolicyEngine kernels: AVX2\n");
+#elif defined(CENTRALISEDAI_POLICYENGINE_NEON)
+  printf("PolicyEngine kernels: NEON\n");
+#else
+  printf("PolicyEngine kernels: scalar\n");
+#endif
+
+  torch::Tensor local_state = torch::randn({1, 1, num_local_states});
+  torch::Tensor hidden_states = torch::zeros({1, 1, hidden_size});
+  benchmark::PrintResult(
+      "PolicyNetwork::Forward (no grad)", benchmark::Measure([&]() {
+        torch::AutoGradMode enable_grad_mode(false);
+        std::tuple<torch::Tensor, torch::Tensor> policy_value =
+            policy.Forward(local_state, hidden_states);
+        hidden_states = std::get<1>(policy_value);
+      }, kIterations, 1000));
+
+  float hidden_state[hidden_size] = {};
+  float logits[num_actions];
+  benchmark::PrintResult(
+      "PolicyEngine::Forward", benchmark::Measure([&]() {
+        engine.Forward(local_state.data_ptr<float>(), hidden_state, logits);
+      }, kIterations, 1000));
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+int main() {
+  torch::manual_seed(0);
+
+  centralised_ai::collective_robot_behaviour::RunBenchmark();
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+/* policy_runner_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Compares the per time step latency of PolicyRunner against the
+ * action selection it replaced, PolicyNetwork::Forward with autograd disabled
+ * followed by a softmax and an argmax, and against PolicyRunner on the policy
+ * exported with ExportPolicy.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C++ standard library headers */
+#include "cstdio"
+#include "filesystem"
+#include "string"
+#include "tuple"
+
+/* Other .h files */
+#include "torch/script.h"
+#include "torch/torch.h"
+
+/* Project .h files */
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/policy_export.h"
+#include "../../src/collective-robot-behaviour/policy_runner.h"
+#include "../../src/common_types.h"
+#include "../benchmark_timer.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Measures both paths for one number of agents. */
+static void RunBenchmark(int64_t num_agents) {
+  const int kIterations = 10000;
+
+  PolicyNetwork policy = CreatePolicy();
+  torch::Tensor local_states = torch::randn({num_agents, num_local_states});
+
+  printf("--- %ld agents ---\n", static_cast<long>(num_agents));
+
+  torch::Tensor hidden_states = torch::zeros({1, num_agents, hidden_size});
+  benchmark::PrintResult(
+      "Forward + softmax + argmax (no grad)", benchmark::Measure([&]() {
+        torch::AutoGradMode enable_grad_mode(false);
+        std::tuple<torch::Tensor, torch::Tensor> policy_value = policy.Forward(
+            local_states.reshape({1, num_agents, num_local_states}),
+            hidden_states);
+        torch::Tensor probabilities =
+            torch::softmax(std::get<0>(policy_value).squeeze(0), 1);
+        torch::Tensor actions = probabilities.argmax(1);
+        hidden_states = std::get<1>(policy_value);
+      }, kIterations, 100));
+
+  PolicyRunner runner(policy, num_agents);
+  benchmark::PrintResult("PolicyRunner::Act", benchmark::Measure([&]() {
+                           runner.Act(local_states);
+                         }, kIterations, 100));
+
+  std::string path =
+      (std::filesystem::temp_directory_path() / "policy_runner_benchmark.pt")
+          .string();
+  PolicyRunner exported_runner(ExportPolicy(policy, path), num_agents);
+  std::filesystem::remove(path);
+  benchmark::PrintResult("PolicyRunner::Act (exported policy)",
+                         benchmark::Measure([&]() {
+                           exported_runner.Act(local_states);
+                         }, kIterations, 100));
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+int main() {
+  torch::manual_seed(0);
+
+  /* One team, and the agents of 16 environments stepped together */
+  centralised_ai::collective_robot_behaviour::RunBenchmark(
+      centralised_ai::amount_of_players_in_team);
+  centralised_ai::collective_robot_behaviour::RunBenchmark(
+      16 * centralised_ai::amount_of_players_in_team);
+
+  return 0;
+}
@@ -0,0 +1,173 @@
+/* utils_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Compares the single-pass reward-to-go, temporal difference and
+ * GAE kernels in utils.cc against the previous element-wise implementations.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C++ standard library headers */
+#include "cmath"
+#include "cstdio"
+#include "cstring"
+#include "string"
+#include "vector"
+
+/* Other .h files */
+#include "torch/torch.h"
+
+/* Project .h files */
+#include "../../src/collective-robot-behaviour/utils.h"
+#include "../../src/common_types.h"
+#include "../benchmark_timer.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* The element-wise reference implementations that the kernels in utils.cc
+ * replaced. Kept here so the speed-up can be measured on the same machine. */
+static torch::Tensor ReferenceRewardToGo(const torch::Tensor& kRewards,
+                                         double discount) {
+  int32_t num_time_steps = kRewards.size(0);
+  torch::Tensor output = torch::zeros(num_time_steps);
+
+  output[num_time_steps - 1] =
+      pow(discount, num_time_steps - 1) * kRewards[num_time_steps - 1];
+  for (int32_t t = num_time_steps - 2; t >= 0; t--) {
+    output[t] = pow(discount, t) * kRewards[t] + output[t + 1];
+  }
+
+  return output;
+}
+
+static torch::Tensor
+ReferenceTemporalDifference(const torch::Tensor& kCriticValues,
+                            const torch::Tensor& kRewards, double discount) {
+  int32_t num_agents = kRewards.size(0);
+  int32_t num_time_steps = kRewards.size(1);
+
+  torch::Tensor temporal_difference =
+      torch::zeros({num_agents, num_time_steps});
+  for (int32_t j = 0; j < num_agents; j++) {
+    for (int32_t t = 0; t < num_time_steps - 1; t++) {
+      temporal_difference[j][t] =
+          kRewards[j][t] + discount * kCriticValues[t + 1] - kCriticValues[t];
+    }
+    temporal_difference[j][num_time_steps - 1] =
+        kRewards[j][num_time_steps - 1] - kCriticValues[num_time_steps - 1];
+  }
+
+  return temporal_difference;
+}
+
+static torch::Tensor
+ReferenceGeneralAdvantageEstimation(const torch::Tensor& kTemporalDifferences,
+                                    double discount, double gae_parameter) {
+  int32_t num_agents = kTemporalDifferences.size(0);
+  int32_t num_time_steps = kTemporalDifferences.size(1);
+
+  torch::Tensor gae = torch::zeros({num_agents, num_time_steps});
+  for (int32_t j = 0; j < num_agents; j++) {
+    for (int32_t t = 0; t < num_time_steps; t++) {
+      for (int32_t m = 0; m <= num_time_steps - t - 1; m++) {
+        gae[j][t] +=
+            pow(discount * gae_parameter, m) * kTemporalDifferences[j][t + m];
+      }
+    }
+  }
+
+  return gae;
+}
+
+/* Runs all kernels for one trajectory length. */
+static void RunBenchmark(int32_t num_time_steps, bool run_slow_reference) {
+  using benchmark::Measure;
+  using benchmark::PrintResult;
+
+  const double kDiscount = 0.99;
+  const double kGaeParameter = 0.95;
+  const int kIterations = num_time_steps > 2000 ? 3 : 20;
+
+  torch::Tensor rewards =
+      torch::randn({amount_of_players_in_team, num_time_steps});
+  torch::Tensor critic_values = torch::randn({num_time_steps});
+  torch::Tensor temporal_differences =
+      ComputeTemporalDifference(critic_values, rewards, kDiscount);
+
+  printf("--- %d agents, %d time steps ---\n", amount_of_players_in_team,
+         num_time_steps);
+
+  /* Reward-to-go. The reference works on one agent at a time. */
+  PrintResult("RewardToGo (rows, single pass)", Measure([&]() {
+                ComputeRewardToGo(rewards, kDiscount);
+              }, kIterations));
+  std::vector<float> output(num_time_steps);
+  torch::Tensor row = rewards[0].contiguous();
+  PrintResult("RewardToGo (raw float, one agent)", Measure([&]() {
+                ComputeRewardToGo(row.data_ptr<float>(), output.data(),
+                                  num_time_steps, kDiscount);
+              }, kIterations));
+  PrintResult("RewardToGo (reference, all agents)", Measure([&]() {
+                for (int32_t a = 0; a < amount_of_players_in_team; a++) {
+                  ReferenceRewardToGo(rewards[a], kDiscount);
+                }
+              }, 1, 0));
+
+  /* Temporal difference. */
+  PrintResult("TemporalDifference (broadcast)", Measure([&]() {
+                ComputeTemporalDifference(critic_values, rewards, kDiscount);
+              }, kIterations));
+  PrintResult("TemporalDifference (reference)", Measure([&]() {
+                ReferenceTemporalDifference(critic_values, rewards,
+                                            kDiscount);
+              }, 1, 0));
+
+  /* General advantage estimation. */
+  PrintResult("GAE (rows, backward recursion)", Measure([&]() {
+                ComputeGeneralAdvantageEstimation(temporal_differences,
+                                                  kDiscount, kGaeParameter);
+              }, kIterations));
+  torch::Tensor delta_row = temporal_differences[0].contiguous();
+  PrintResult("GAE (raw float, one agent)", Measure([&]() {
+                ComputeGeneralAdvantageEstimation(delta_row.data_ptr<float>(),
+                                                  output.data(),
+                                                  num_time_steps, kDiscount,
+                                                  kGaeParameter);
+              }, kIterations));
+
+  if (run_slow_reference) {
+    torch::Tensor reference;
+    PrintResult("GAE (reference, O(T^2))", Measure([&]() {
+                  reference = ReferenceGeneralAdvantageEstimation(
+                      temporal_differences, kDiscount, kGaeParameter);
+                }, 1, 0));
+
+    torch::Tensor result = ComputeGeneralAdvantageEstimation(
+        temporal_differences, kDiscount, kGaeParameter);
+    printf("GAE max abs difference to reference: %g\n",
+           (result - reference).abs().max().item<float>());
+  } else {
+    printf("GAE (reference, O(T^2)) skipped, run with --full to include it\n");
+  }
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+int main(int argc, char** argv) {
+  /* The quadratic reference takes minutes for long trajectories, so it is only
+   * run for the longest trajectory when explicitly asked for. */
+  bool full = argc > 1 && std::strcmp(argv[1], "--full") == 0;
+
+  torch::manual_seed(0);
+  centralised_ai::collective_robot_behaviour::RunBenchmark(200, true);
+  centralised_ai::collective_robot_behaviour::RunBenchmark(2000, true);
+  centralised_ai::collective_robot_behaviour::RunBenchmark(20000, full);
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/* vectorized_runner_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Measures how the rollout collection rate of VectorizedRunner
+ * scales with the number of in-process environments, against MappoRun which
+ * steps a single environment.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C++ standard library headers */
+#include "algorithm"
+#include "chrono"
+#include "cstdio"
+#include "memory"
+#include "thread"
+#include "vector"
+
+/* Other .h files */
+#include "torch/torch.h"
+
+/* Project .h files */
+#include "../../src/collective-robot-behaviour/mappo.h"
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/rollout_storage.h"
+#include "../../src/collective-robot-behaviour/vectorized_runner.h"
+#include "../../src/common_types.h"
+#include "../../src/headless-simulation/headless_simulator.h"
+#include "../../src/headless-simulation/simulated_command_channel.h"
+#include "../../src/headless-simulation/simulated_referee.h"
+#include "../../src/headless-simulation/simulated_vision_client.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* The interfaces of one in-process game, with the game started */
+struct HeadlessGame {
+  headless_simulation::HeadlessSimulator simulator;
+  headless_simulation::SimulatedVisionClient vision_client{simulator};
+  headless_simulation::SimulatedReferee referee{vision_client, simulator};
+  headless_simulation::SimulatedCommandChannel command_channel{simulator,
+                                                               Team::kBlue};
+
+  HeadlessGame() { referee.StartGame(Team::kBlue, Team::kYellow, 3.0F, 300); }
+};
+
+/* Returns environment time steps per second of a call to run, which
+ * collects the given number of episodes */
+template <typename Function>
+static double MeasureStepsPerSecond(Function&& run, int64_t episodes) {
+  auto start = std::chrono::steady_clock::now();
+  run();
+  auto end = std::chrono::steady_clock::now();
+
+  return static_cast<double>(episodes * (max_timesteps - 1)) /
+         std::chrono::duration<double>(end - start).count();
+}
+
+/* Collects batch_size episodes with MappoRun and with VectorizedRunner for a
+ * growing number of environments */
+static void RunBenchmark() {
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  CriticNetwork critic;
+
+  /* MappoRun, one environment and one forward pass per environment step */
+  HeadlessGame game;
+  double mappo_run = MeasureStepsPerSecond([&]() {
+    MappoRun(policy, critic, game.referee, game.vision_client, Team::kBlue,
+             game.command_channel);
+  }, batch_size);
+  printf("%-34s %10.0f steps/s\n", "MappoRun, 1 environment", mappo_run);
+
+  int max_environments =
+      std::max(1U, 2 * std::thread::hardware_concurrency());
+  for (int num_environments = 1; num_environments <= max_environments;
+       num_environments *= 2) {
+    std::vector<std::unique_ptr<HeadlessGame>> games;
+    std::vector<Environment> environments;
+    for (int i = 0; i < num_environments; i++) {
+      games.push_back(std::make_unique<HeadlessGame>());
+      environments.push_back({games.back()->referee,
+                              games.back()->vision_client,
+                              games.back()->command_channel});
+    }
+
+    VectorizedRunner runner(environments, Team::kBlue);
+    int64_t episodes_per_environment =
+        (batch_size + num_environments - 1) / num_environments;
+    double steps_per_second = MeasureStepsPerSecond([&]() {
+      runner.Run(policy, critic, episodes_per_environment);
+    }, episodes_per_environment * num_environments);
+
+    printf("VectorizedRunner, %3d environments %10.0f steps/s (%5.2fx)\n",
+           num_environments, steps_per_second, steps_per_second / mappo_run);
+  }
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+int main() {
+  printf("%u cores, %d time steps per episode\n",
+         std::thread::hardware_concurrency(),
+         centralised_ai::max_timesteps - 1);
+  centralised_ai::collective_robot_behaviour::RunBenchmark();
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+/* headless_simulator_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Measures how many steps per second and core the headless
+ * simulator runs, both alone and through the same vision client, referee and
+ * command channel interfaces that MappoRun uses. grSim steps at the vision
+ * frame rate of 60 Hz.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C++ standard library headers */
+#include "algorithm"
+#include "chrono"
+#include "cstdio"
+#include "cstdlib"
+#include "functional"
+#include "thread"
+#include "vector"
+
+/* Project .h files */
+#include "../../src/common_types.h"
+#include "../../src/headless-simulation/headless_simulator.h"
+#include "../../src/headless-simulation/simulated_command_channel.h"
+#include "../../src/headless-simulation/simulated_referee.h"
+#include "../../src/headless-simulation/simulated_vision_client.h"
+
+using centralised_ai::headless_simulation::HeadlessSimulator;
+
+/* Velocity commands of the six discrete actions, cycled through per robot
+ * so that robots move, turn and collide */
+static const float kActions[6][3] = {
+  {0.0F, 0.0F, 0.0F}, {1.0F, 0.0F, 0.0F}, {-1.0F, 0.0F, 0.0F},
+  {0.0F, 1.0F, 0.0F}, {0.0F, -1.0F, 0.0F}, {0.5F, 0.0F, 3.0F}
+};
+
+/* Steps the simulator alone */
+static void RunSimulatorSteps(int steps)
+{
+  HeadlessSimulator simulator;
+
+  for (int step = 0; step < steps; step++)
+  {
+    for (int id = 0; id < centralised_ai::amount_of_players_in_team; id++)
+    {
+      const float* action = kActions[(step / 30 + id) % 6];
+      simulator.SetRobotVelocity(id, centralised_ai::Team::kBlue, action[0],
+                                 action[1], action[2]);
+    }
+    simulator.Step();
+  }
+}
+
+/* Steps the simulator the way MappoRun does: commands through the channel,
+ * observations through the vision client and the referee */
+static void RunInterfaceSteps(int steps)
+{
+  HeadlessSimulator simulator;
+  centralised_ai::headless_simulation::SimulatedVisionClient vision_client(
+      simulator);
+  centralised_ai::headless_simulation::SimulatedReferee referee(
+      vision_client, simulator);
+  centralised_ai::headless_simulation::SimulatedCommandChannel channel(
+      simulator, centralised_ai::Team::kBlue);
+
+  referee.StartGame(centralised_ai::Team::kBlue,
+                    centralised_ai::Team::kYellow, 3.0F, 300);
+  for (int step = 0; step < steps; step++)
+  {
+    vision_client.ReceivePacket();
+    referee.AnalyzeGameState();
+    for (int id = 0; id < centralised_ai::amount_of_players_in_team; id++)
+    {
+      const float* action = kActions[(step / 30 + id) % 6];
+      channel.SetVelocity(id, action[0], action[1], action[2]);
+    }
+    channel.SendPacket();
+  }
+}
+
+/* Runs one independent simulation per thread and returns steps per second
+ * summed over all threads */
+static double MeasureStepsPerSecond(const std::function<void(int)>& run,
+    int steps, int thread_count)
+{
+  std::vector<std::thread> threads;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < thread_count; i++)
+  {
+    threads.emplace_back(run, steps);
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  return static_cast<double>(steps) * thread_count /
+      std::chrono::duration<double>(end - start).count();
+}
+
+/* Prints steps per second on one core and on all cores */
+static void Report(const char* name, const std::function<void(int)>& run,
+    int steps, int thread_count)
+{
+  double single = MeasureStepsPerSecond(run, steps, 1);
+  double all = MeasureStepsPerSecond(run, steps, thread_count);
+
+  printf("%-28s 1 core: %11.0f steps/s (%6.0fx real time)   "
+      "%d cores: %11.0f steps/s, %11.0f steps/s/core\n",
+      name, single, single * HeadlessSimulator::kTimeStep, thread_count, all,
+      all / thread_count);
+}
+
+int main(int argc, char* argv[])
+{
+  int steps = (argc > 1) ? std::atoi(argv[1]) : 200000;
+  int thread_count = std::max(1U, std::thread::hardware_concurrency());
+
+  printf("%d steps of %.4f s simulated time per run\n", steps,
+      HeadlessSimulator::kTimeStep);
+
+  Report("simulator only", RunSimulatorSteps, steps, thread_count);
+  Report("vision, referee, channel", RunInterfaceSteps, steps, thread_count);
+
+  return 0;
+}
@@ -0,0 +1,201 @@
+/* team_command_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Compares the per tick overhead of sending the commands of a
+ * team: the previous control path that copied a vector of per robot
+ * interfaces every tick, one SimulationInterface per robot passed by span, and
+ * one TeamCommandChannel passed by reference.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C system headers */
+#include "arpa/inet.h"
+#include "netinet/in.h"
+#include "sys/socket.h"
+
+/* C++ standard library headers */
+#include "cstdint"
+#include "cstdio"
+#include "cstdlib"
+#include "span"
+#include "string"
+#include "vector"
+
+/* Project .h files */
+#include "../../src/common_types.h"
+#include "../../src/simulation-interface/simulation_interface.h"
+#include "../../src/simulation-interface/team_command_channel.h"
+#include "../allocation_counter.h"
+#include "../benchmark_timer.h"
+
+/* Nothing needs to listen on the port, the packets are dropped by the
+ * kernel after being sent */
+static const char* kGrsimIp = "127.0.0.1";
+static const uint16_t kGrsimPort = 20099;
+
+/* Copyable replica of SimulationInterface as it was before it owned its
+ * socket, which is what the previous SendActions and MappoRun copied */
+struct LegacyRobotInterface
+{
+  int socket;
+  sockaddr_in destination;
+  int id;
+  centralised_ai::Team team;
+  bool spinner_on;
+  float kicker_speed;
+  float x_speed;
+  float y_speed;
+  float angular_speed;
+  float wheel_1;
+  float wheel_2;
+  float wheel_3;
+  float wheel_4;
+  bool using_wheel_speed;
+};
+
+/* The previous SimulationInterface::CreateProtoPacket */
+static GrSimPacket LegacyCreateProtoPacket(const LegacyRobotInterface& robot)
+{
+  GrSimPacket packet;
+  GrSimRobotCommand *command;
+
+  packet.mutable_commands()->set_is_team_yellow(
+      robot.team == centralised_ai::Team::kYellow);
+  packet.mutable_commands()->set_timestamp(0.0L);
+  command = packet.mutable_commands()->add_robot_commands();
+  command->set_id(robot.id);
+  command->set_kick_speed_x(robot.kicker_speed);
+  command->set_kick_speed_z(0.0F);
+  command->set_spinner(robot.spinner_on);
+  command->set_wheels_speed(robot.using_wheel_speed);
+  command->set_wheel_1(robot.wheel_1);
+  command->set_wheel_2(robot.wheel_2);
+  command->set_wheel_3(robot.wheel_3);
+  command->set_wheel_4(robot.wheel_4);
+  command->set_vel_tangent(robot.x_speed);
+  command->set_vel_normal(robot.y_speed);
+  command->set_vel_angular(robot.angular_speed);
+
+  return packet;
+}
+
+/* The previous SimulationInterface::SendPacket(GrSimPacket) */
+static void LegacySendPacket(LegacyRobotInterface& robot, GrSimPacket packet)
+{
+  size_t size;
+  void *buffer;
+
+  size = packet.ByteSizeLong();
+  buffer = malloc(size);
+  packet.SerializeToArray(buffer, size);
+  ::sendto(robot.socket, buffer, size, 0,
+      reinterpret_cast<sockaddr *>(&robot.destination),
+      sizeof(robot.destination));
+  free(buffer);
+}
+
+/* The previous SimulationInterface::SendPacket() */
+static void LegacySendPacket(LegacyRobotInterface& robot)
+{
+  GrSimPacket packet;
+
+  packet = LegacyCreateProtoPacket(robot);
+  LegacySendPacket(robot, packet);
+}
+
+/* The previous control path, taking the interfaces by value */
+static void LegacySendActions(std::vector<LegacyRobotInterface> robots,
+                              float x_speed)
+{
+  for (LegacyRobotInterface& robot : robots)
+  {
+    robot.using_wheel_speed = false;
+    robot.x_speed = x_speed;
+    robot.y_speed = 0.0F;
+    robot.angular_speed = 0.0F;
+    LegacySendPacket(robot);
+  }
+}
+
+/* Per robot interfaces passed without copying */
+static void SpanSendActions(
+    std::span<centralised_ai::simulation_interface::SimulationInterface>
+        robot_interfaces,
+    float x_speed)
+{
+  for (auto& robot_interface : robot_interfaces)
+  {
+    robot_interface.SetVelocity(x_speed, 0.0F, 0.0F);
+    robot_interface.SendPacket();
+  }
+}
+
+/* One channel for the team, passed by reference */
+static void ChannelSendActions(
+    centralised_ai::simulation_interface::TeamCommandChannel& channel,
+    float x_speed)
+{
+  for (int id = 0; id < centralised_ai::amount_of_players_in_team; id++)
+  {
+    channel.SetVelocity(id, x_speed, 0.0F, 0.0F);
+  }
+  channel.SendPacket();
+}
+
+/* Measures one way of sending a tick and prints time, syscalls and
+ * allocations per tick */
+template <typename Tick>
+static void RunCase(const std::string& name, int sends_per_tick, Tick tick)
+{
+  namespace benchmark = centralised_ai::benchmark;
+  const int kTicks = 10000;
+  int64_t allocations_before = benchmark::GetAllocationCount();
+
+  benchmark::PrintResult(name, benchmark::Measure(tick, kTicks));
+  printf("%-48s %d sendto, %.2f allocations per tick\n", "", sends_per_tick,
+      static_cast<double>(benchmark::GetAllocationCount() -
+          allocations_before) / (kTicks + 1));
+}
+
+int main()
+{
+  using centralised_ai::simulation_interface::SimulationInterface;
+  using centralised_ai::simulation_interface::TeamCommandChannel;
+  using centralised_ai::amount_of_players_in_team;
+
+  int tick = 0;
+
+  std::vector<LegacyRobotInterface> legacy_robots(amount_of_players_in_team);
+  std::vector<SimulationInterface> robot_interfaces;
+  for (int id = 0; id < amount_of_players_in_team; id++)
+  {
+    robot_interfaces.emplace_back(kGrsimIp, kGrsimPort, id,
+        centralised_ai::Team::kBlue);
+    legacy_robots[id] = LegacyRobotInterface();
+    legacy_robots[id].socket = ::socket(AF_INET, SOCK_DGRAM, 0);
+    legacy_robots[id].destination.sin_family = AF_INET;
+    legacy_robots[id].destination.sin_port = htons(kGrsimPort);
+    legacy_robots[id].destination.sin_addr.s_addr = inet_addr(kGrsimIp);
+    legacy_robots[id].id = id;
+    legacy_robots[id].team = centralised_ai::Team::kBlue;
+  }
+  TeamCommandChannel channel(kGrsimIp, kGrsimPort,
+      centralised_ai::Team::kBlue);
+
+  printf("Sending commands to %d robots per tick\n",
+      amount_of_players_in_team);
+
+  /* Every tick sends a new velocity to every robot */
+  RunCase("vector copied per tick (before, per tick)",
+      amount_of_players_in_team,
+      [&]() { LegacySendActions(legacy_robots, 0.5F * (tick++ % 2)); });
+  RunCase("SimulationInterface span (per tick)", amount_of_players_in_team,
+      [&]() { SpanSendActions(robot_interfaces, 0.5F * (tick++ % 2)); });
+  RunCase("TeamCommandChannel reference (after, per tick)", 1,
+      [&]() { ChannelSendActions(channel, 0.5F * (tick++ % 2)); });
+
+  return 0;
+}
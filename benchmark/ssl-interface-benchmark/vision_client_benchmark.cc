@@ -0,0 +1,203 @@
+/* vision_client_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Measures the latency of one control loop tick that reads the
+ * game state from VisionClient, with blocking and with background receiving,
+ * and the age of the observation when the loop is slower than vision.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C system headers */
+#include "arpa/inet.h"
+#include "netinet/in.h"
+#include "sys/socket.h"
+#include "unistd.h"
+
+/* C++ standard library headers */
+#include "atomic"
+#include "chrono"
+#include "cstdio"
+#include "string"
+#include "thread"
+
+/* Project .h files */
+#include "../../src/common_types.h"
+#include "../../src/ssl-interface/generated/ssl_vision_detection.pb.h"
+#include "../../src/ssl-interface/generated/ssl_vision_wrapper.pb.h"
+#include "../../src/ssl-interface/ssl_vision_client.h"
+#include "../benchmark_timer.h"
+
+namespace centralised_ai
+{
+namespace ssl_interface
+{
+
+/* Port the benchmark sends its own vision packets to */
+static const int kBenchmarkPort = 10020;
+
+/* grSim publishes vision at 60 Hz */
+static const std::chrono::microseconds kFramePeriod(16667);
+
+/* Seconds on the steady clock, used as capture time of the sent frames */
+static double Now()
+{
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Sends detection frames with all robots and the ball to localhost at the
+ * vision frame rate until stopped */
+static void SendFrames(const std::atomic<bool>& running)
+{
+  SslWrapperPacket packet;
+  SslDetectionFrame* detection = packet.mutable_detection();
+  std::string serialized_data;
+  sockaddr_in destination;
+  int sender_socket = socket(AF_INET, SOCK_DGRAM, 0);
+  int frame_number = 0;
+
+  destination.sin_family = AF_INET;
+  destination.sin_port = htons(kBenchmarkPort);
+  destination.sin_addr.s_addr = inet_addr("127.0.0.1");
+
+  detection->set_camera_id(0);
+  detection->set_t_sent(0.0);
+  for (int id = 0; id < amount_of_players_in_team; id++)
+  {
+    SslDetectionRobot* blue = detection->add_robots_blue();
+    SslDetectionRobot* yellow = detection->add_robots_yellow();
+    blue->set_robot_id(id);
+    blue->set_x(-1000.0f + 100.0f * id);
+    blue->set_y(500.0f);
+    blue->set_orientation(0.0f);
+    blue->set_confidence(1.0f);
+    blue->set_pixel_x(0);
+    blue->set_pixel_y(0);
+    yellow->set_robot_id(id);
+    yellow->set_x(1000.0f - 100.0f * id);
+    yellow->set_y(-500.0f);
+    yellow->set_orientation(3.14f);
+    yellow->set_confidence(1.0f);
+    yellow->set_pixel_x(0);
+    yellow->set_pixel_y(0);
+  }
+  SslDetectionBall* ball = detection->add_balls();
+  ball->set_x(0.0f);
+  ball->set_y(0.0f);
+  ball->set_confidence(1.0f);
+  ball->set_pixel_x(0);
+  ball->set_pixel_y(0);
+
+  auto next_send = std::chrono::steady_clock::now();
+  while (running.load())
+  {
+    detection->set_frame_number(frame_number);
+    detection->set_t_capture(Now());
+    frame_number++;
+
+    packet.SerializeToString(&serialized_data);
+    sendto(sender_socket, serialized_data.data(), serialized_data.size(), 0,
+        reinterpret_cast<const sockaddr*>(&destination), sizeof(destination));
+
+    next_send += kFramePeriod;
+    std::this_thread::sleep_until(next_send);
+  }
+
+  close(sender_socket);
+}
+
+/* One control loop tick: refresh the client and read everything that
+ * GetGlobalState reads */
+static float Tick(VisionClient& vision_client)
+{
+  float sum = 0.0f;
+
+  vision_client.ReceivePacket();
+  sum += vision_client.GetBallPositionX() + vision_client.GetBallPositionY();
+  for (int id = 0; id < amount_of_players_in_team; id++)
+  {
+    sum += vision_client.GetRobotPositionX(id, Team::kBlue);
+    sum += vision_client.GetRobotPositionY(id, Team::kBlue);
+    sum += vision_client.GetRobotOrientation(id, Team::kBlue);
+  }
+
+  return sum;
+}
+
+/* Runs a loop whose ticks take longer than a vision frame and prints how old
+ * the observation is on average and how many packets each tick received */
+static void MeasureObservationAge(const char* name, VisionClient& vision_client,
+                                  bool drain)
+{
+  const int kTicks = 30;
+  const std::chrono::milliseconds kTickWork(40);
+  double total_age = 0.0;
+  uint64_t received_before;
+  uint64_t discarded_before;
+
+  /* Start from an empty queue */
+  vision_client.SetDrainQueuedPackets(true);
+  vision_client.ReceivePacket();
+  vision_client.SetDrainQueuedPackets(drain);
+
+  received_before = vision_client.GetReceivedPacketCount();
+  discarded_before = vision_client.GetDiscardedPacketCount();
+  for (int tick = 0; tick < kTicks; tick++)
+  {
+    std::this_thread::sleep_for(kTickWork);
+    Tick(vision_client);
+    total_age += Now() - vision_client.GetTimestamp();
+  }
+
+  printf("%-48s mean age=%9.2f ms  packets/tick=%5.2f  discarded/tick=%5.2f\n",
+      name, 1000.0 * total_age / kTicks,
+      static_cast<double>(vision_client.GetReceivedPacketCount() -
+          received_before) / kTicks,
+      static_cast<double>(vision_client.GetDiscardedPacketCount() -
+          discarded_before) / kTicks);
+}
+
+} /* namespace ssl_interface */
+} /* namespace centralised_ai */
+
+int main()
+{
+  using centralised_ai::ssl_interface::VisionClient;
+  using centralised_ai::ssl_interface::Tick;
+  namespace benchmark = centralised_ai::benchmark;
+
+  const int kIterations = 120;
+  std::atomic<bool> running(true);
+  volatile float sink = 0.0f;
+
+  VisionClient vision_client("127.0.0.1",
+      centralised_ai::ssl_interface::kBenchmarkPort);
+  std::thread sender(centralised_ai::ssl_interface::SendFrames,
+      std::cref(running));
+
+  printf("Control loop tick latency, vision packets at 60 Hz, %d ticks\n",
+      kIterations);
+
+  benchmark::PrintResult("blocking ReceivePacket",
+      benchmark::Measure([&]() { sink = Tick(vision_client); }, kIterations));
+
+  vision_client.StartBackgroundReceive();
+  vision_client.ReceivePacketsUntilAllDataRead();
+  benchmark::PrintResult("background ReceivePacket",
+      benchmark::Measure([&]() { sink = Tick(vision_client); }, kIterations));
+  vision_client.StopBackgroundReceive();
+
+  printf("\nObservation age with 40 ms of work per tick\n");
+  centralised_ai::ssl_interface::MeasureObservationAge(
+      "blocking ReceivePacket, one packet per tick", vision_client, false);
+  centralised_ai::ssl_interface::MeasureObservationAge(
+      "blocking ReceivePacket, drain queued packets", vision_client, true);
+
+  running.store(false);
+  sender.join();
+
+  return 0;
+}
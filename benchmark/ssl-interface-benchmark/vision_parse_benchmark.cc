@@ -0,0 +1,218 @@
+/* vision_parse_benchmark.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Measures parse time and heap allocations per vision packet for
+ * the reused arena packet in VisionClient and for the previous path that
+ * created and copied a new packet each time.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* C++ standard library headers */
+#include "cstdint"
+#include "cstdio"
+#include "fstream"
+#include "string"
+#include "vector"
+
+/* Project .h files */
+#include "../../src/common_types.h"
+#include "../../src/ssl-interface/generated/ssl_vision_detection.pb.h"
+#include "../../src/ssl-interface/generated/ssl_vision_wrapper.pb.h"
+#include "../../src/ssl-interface/ssl_vision_client.h"
+#include "../allocation_counter.h"
+#include "../benchmark_timer.h"
+
+namespace centralised_ai
+{
+namespace ssl_interface
+{
+
+/* Exposes the parse path of VisionClient without receiving from a socket */
+class ParseBenchmarkClient : public VisionClient
+{
+ public:
+  ParseBenchmarkClient() : VisionClient("127.0.0.1", 10021) {}
+
+  void Parse(const std::string& data)
+  {
+    if (ParsePacket(data.data(), data.size()))
+    {
+      ReadVisionData(*packet_);
+    }
+  }
+};
+
+/* Positions read by the reference path */
+static float reference_positions[2 * amount_of_players_in_team + 2];
+
+/* The path that ReceivePacket used before: a new packet per datagram, passed
+ * by value, with the detection, robots and ball copied into locals */
+static void ReferenceReadVisionData(SslWrapperPacket packet)
+{
+  SslDetectionFrame detection;
+  SslDetectionRobot robot;
+  SslDetectionBall ball;
+
+  if (packet.has_detection())
+  {
+    detection = packet.detection();
+    for (int i = 0; i < detection.robots_blue_size(); ++i)
+    {
+      robot = detection.robots_blue(i);
+      if (robot.robot_id() < amount_of_players_in_team)
+      {
+        reference_positions[2 * robot.robot_id()] = robot.x();
+        reference_positions[2 * robot.robot_id() + 1] = robot.y();
+      }
+    }
+    if (detection.balls_size() > 0)
+    {
+      ball = detection.balls(0);
+      reference_positions[2 * amount_of_players_in_team] = ball.x();
+      reference_positions[2 * amount_of_players_in_team + 1] = ball.y();
+    }
+  }
+}
+
+static void ReferenceParse(const std::string& data)
+{
+  SslWrapperPacket packet;
+  packet.ParseFromArray(data.data(), data.size());
+  ReferenceReadVisionData(packet);
+}
+
+/* Builds packets like those grSim sends, with a full set of 16 robots per
+ * team seen by one of four cameras */
+static std::vector<std::string> CreatePackets(int count)
+{
+  std::vector<std::string> packets;
+
+  for (int frame = 0; frame < count; frame++)
+  {
+    SslWrapperPacket packet;
+    SslDetectionFrame* detection = packet.mutable_detection();
+    detection->set_frame_number(frame);
+    detection->set_t_capture(frame / 60.0);
+    detection->set_t_sent(frame / 60.0);
+    detection->set_camera_id(frame % 4);
+
+    for (int id = 0; id < 16; id++)
+    {
+      SslDetectionRobot* blue = detection->add_robots_blue();
+      SslDetectionRobot* yellow = detection->add_robots_yellow();
+      blue->set_robot_id(id);
+      blue->set_x(-3000.0f + 10.0f * frame + 50.0f * id);
+      blue->set_y(100.0f * id);
+      blue->set_orientation(0.01f * frame);
+      blue->set_confidence(0.9f);
+      blue->set_pixel_x(10.0f * id);
+      blue->set_pixel_y(20.0f * id);
+      yellow->set_robot_id(id);
+      yellow->set_x(3000.0f - 10.0f * frame - 50.0f * id);
+      yellow->set_y(-100.0f * id);
+      yellow->set_orientation(-0.01f * frame);
+      yellow->set_confidence(0.9f);
+      yellow->set_pixel_x(10.0f * id);
+      yellow->set_pixel_y(20.0f * id);
+    }
+
+    SslDetectionBall* ball = detection->add_balls();
+    ball->set_x(5.0f * frame);
+    ball->set_y(-5.0f * frame);
+    ball->set_confidence(1.0f);
+    ball->set_pixel_x(320.0f);
+    ball->set_pixel_y(240.0f);
+
+    packets.push_back(packet.SerializeAsString());
+  }
+
+  return packets;
+}
+
+/* Reads packets recorded as a 32 bit little endian length followed by the
+ * datagram payload */
+static std::vector<std::string> LoadPackets(const char* path)
+{
+  std::vector<std::string> packets;
+  std::ifstream file(path, std::ios::binary);
+  uint8_t header[4];
+
+  while (file.read(reinterpret_cast<char*>(header), sizeof(header)))
+  {
+    uint32_t length = header[0] | (header[1] << 8) | (header[2] << 16) |
+                      (static_cast<uint32_t>(header[3]) << 24);
+    std::string payload(length, '\0');
+    if (!file.read(&payload[0], length))
+    {
+      break;
+    }
+    packets.push_back(payload);
+  }
+
+  return packets;
+}
+
+/* Parses every packet once per iteration and prints time and allocations
+ * per packet */
+template <typename ParseFunction>
+static void RunCase(const std::string& name,
+                    const std::vector<std::string>& packets,
+                    ParseFunction parse)
+{
+  const int kIterations = 20;
+  int64_t allocations_before;
+  int64_t allocations;
+
+  auto parse_all = [&]()
+  {
+    for (const std::string& data : packets)
+    {
+      parse(data);
+    }
+  };
+
+  /* Warm up once so that reused buffers have reached their final size */
+  parse_all();
+  allocations_before = benchmark::GetAllocationCount();
+  parse_all();
+  allocations = benchmark::GetAllocationCount() - allocations_before;
+
+  benchmark::BenchmarkResult result =
+      benchmark::Measure(parse_all, kIterations, 0);
+  result.mean_us /= packets.size();
+  result.median_us /= packets.size();
+  result.max_us /= packets.size();
+
+  benchmark::PrintResult(name + " (per packet)", result);
+  printf("%-48s %.2f allocations per packet\n", "",
+      static_cast<double>(allocations) / packets.size());
+}
+
+} /* namespace ssl_interface */
+} /* namespace centralised_ai */
+
+int main(int argc, char** argv)
+{
+  using namespace centralised_ai::ssl_interface;
+
+  /* Parse a recording if one is given, otherwise generated packets */
+  std::vector<std::string> packets =
+      argc > 1 ? LoadPackets(argv[1]) : CreatePackets(600);
+  if (packets.empty())
+  {
+    printf("No packets to parse\n");
+    return 1;
+  }
+
+  ParseBenchmarkClient client;
+
+  printf("Parsing %zu vision packets\n", packets.size());
+  RunCase("new packet, copied by value", packets, ReferenceParse);
+  RunCase("reused arena packet, const references", packets,
+      [&](const std::string& data) { client.Parse(data); });
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+/* actor_learner_pipeline.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Training loop that collects the next rollout on a collector
+ * thread while the learner trains on the previous one.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "actor_learner_pipeline.h"
+#include "condition_variable"
+#include "deque"
+#include "exception"
+#include "functional"
+#include "mappo_trainer.h"
+#include "memory"
+#include "mutex"
+#include "network.h"
+#include "rollout_storage.h"
+#include "stdint.h"
+#include "thread"
+#include "torch/torch.h"
+#include "utility"
+#include "vector"
+#include "vectorized_runner.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+ActorLearnerPipeline::ActorLearnerPipeline(
+    VectorizedRunner& runner, MappoTrainer& trainer,
+    int64_t episodes_per_environment, int64_t max_staleness,
+    std::function<void()> prepare_rollout)
+    : runner_(runner), trainer_(trainer),
+      episodes_per_environment_(episodes_per_environment),
+      max_staleness_(max_staleness),
+      prepare_rollout_(std::move(prepare_rollout)), updates_done_(0),
+      stopping_(false) {}
+
+ActorLearnerPipeline::~ActorLearnerPipeline() { Stop(); }
+
+void ActorLearnerPipeline::Start() {
+  PublishWeights(0);
+  collector_thread_ = std::thread(&ActorLearnerPipeline::CollectLoop, this);
+}
+
+void ActorLearnerPipeline::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  weights_published_.notify_all();
+
+  if (collector_thread_.joinable()) {
+    collector_thread_.join();
+  }
+}
+
+PipelineStep ActorLearnerPipeline::Step() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  rollout_collected_.wait(lock, [this] {
+    return !collected_rollouts_.empty() || collector_error_;
+  });
+  if (collected_rollouts_.empty()) {
+    std::rethrow_exception(collector_error_);
+  }
+
+  CollectedRollout collected = std::move(collected_rollouts_.front());
+  collected_rollouts_.pop_front();
+  int64_t update_index = updates_done_;
+  lock.unlock();
+
+  /* The collector keeps stepping the environments with its own copy of the
+   * weights while the learner trains */
+  torch::Tensor losses = trainer_.Update(collected.rollout);
+  PublishWeights(update_index + 1);
+
+  return {collected.rollout, losses, update_index - collected.weights_version};
+}
+
+void ActorLearnerPipeline::CollectLoop() {
+  int64_t loaded_version = -1;
+
+  try {
+    for (int64_t rollout_index = 0;; rollout_index++) {
+      std::shared_ptr<const WeightSnapshot> weights;
+      {
+        /* Wait until collecting this rollout keeps within the staleness
+         * bound */
+        std::unique_lock<std::mutex> lock(mutex_);
+        weights_published_.wait(lock, [&] {
+          return stopping_ || updates_done_ >= rollout_index - max_staleness_;
+        });
+        if (stopping_) {
+          return;
+        }
+        weights = latest_weights_;
+      }
+
+      /* Swap in new weights between rollouts only */
+      if (weights->version != loaded_version) {
+        LoadWeights(*weights);
+        loaded_version = weights->version;
+      }
+
+      if (prepare_rollout_) {
+        prepare_rollout_();
+      }
+      RolloutStorage rollout = runner_.Run(actor_policy_, actor_critic_,
+                                           episodes_per_environment_);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        collected_rollouts_.push_back({std::move(rollout), weights->version});
+      }
+      rollout_collected_.notify_one();
+    }
+  } catch (...) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      collector_error_ = std::current_exception();
+    }
+    rollout_collected_.notify_one();
+  }
+}
+
+void ActorLearnerPipeline::PublishWeights(int64_t updates_done) {
+  std::shared_ptr<WeightSnapshot> snapshot =
+      std::make_shared<WeightSnapshot>();
+
+  {
+    torch::NoGradGuard no_grad;
+    for (const torch::Tensor& kParameter : trainer_.GetPolicy().parameters()) {
+      snapshot->policy_parameters.push_back(kParameter.detach().clone());
+    }
+    for (const torch::Tensor& kParameter : trainer_.GetCritic().parameters()) {
+      snapshot->critic_parameters.push_back(kParameter.detach().clone());
+    }
+  }
+  snapshot->version = updates_done;
+
+  /* The update count and the weights change together, so the collector never
+   * pairs a new count with old weights */
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    updates_done_ = updates_done;
+    latest_weights_ = std::move(snapshot);
+  }
+  weights_published_.notify_all();
+}
+
+void ActorLearnerPipeline::LoadWeights(const WeightSnapshot& snapshot) {
+  CopyParameters(snapshot.policy_parameters, actor_policy_);
+  CopyParameters(snapshot.critic_parameters, actor_critic_);
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,251 @@
+/* actor_learner_pipeline.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Training loop that collects the next rollout on a collector
+ * thread while the learner trains on the previous one.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_ACTORLEARNERPIPELINE_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_ACTORLEARNERPIPELINE_H_
+
+#include "condition_variable"
+#include "deque"
+#include "exception"
+#include "functional"
+#include "mappo_trainer.h"
+#include "memory"
+#include "mutex"
+#include "network.h"
+#include "rollout_storage.h"
+#include "stdint.h"
+#include "thread"
+#include "torch/torch.h"
+#include "vector"
+#include "vectorized_runner.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief Result of one update of the pipeline.
+ */
+struct PipelineStep {
+  /*!
+   * @brief The rollout that the networks were trained on.
+   */
+  RolloutStorage rollout;
+
+  /*!
+   * @brief Losses returned by MappoTrainer::Update, [policy_loss,
+   * critic_loss].
+   */
+  torch::Tensor losses;
+
+  /*!
+   * @brief Number of updates between the weights that collected the rollout
+   * and the weights that were trained on it, 0 when the rollout was collected
+   * with the latest weights.
+   */
+  int64_t staleness;
+};
+
+/*!
+ * @brief Class that overlaps the collection of rollouts with training.
+ *
+ * A collector thread keeps running VectorizedRunner with its own copy of the
+ * networks, while the learner calls Step() to run MappoTrainer::Update on the
+ * oldest collected rollout. After each update the learner publishes a
+ * snapshot of the weights, and the collector swaps it in between two
+ * rollouts, so a rollout is always collected with one consistent set of
+ * weights.
+ *
+ * The collector starts rollout n only when at least n - max_staleness
+ * updates are done, so no rollout is trained on more than max_staleness
+ * updates after the weights that collected it. With max_staleness 0 the
+ * collection and training alternate as in the sequential loop, with 1 the
+ * next rollout is collected while the previous one is trained on.
+ *
+ * @note Not copyable, not moveable.
+ */
+class ActorLearnerPipeline
+{
+ public:
+  /*!
+   * @brief Constructor, the collector is not started until Start().
+   *
+   * @param[in] runner Runner collecting the rollouts, used only by the
+   * collector thread.
+   *
+   * @param[in] trainer Trainer of the networks, used only by the learner.
+   *
+   * @param[in] episodes_per_environment Number of episodes per environment in
+   * each rollout.
+   *
+   * @param[in] max_staleness Maximum number of updates between collecting a
+   * rollout and training on it.
+   *
+   * @param[in] prepare_rollout Called on the collector thread before each
+   * rollout, for example to start the games of the referees.
+   */
+  ActorLearnerPipeline(VectorizedRunner& runner, MappoTrainer& trainer,
+                       int64_t episodes_per_environment, int64_t max_staleness,
+                       std::function<void()> prepare_rollout = nullptr);
+
+  /*!
+   * @brief Destructor, stops the collector.
+   */
+  ~ActorLearnerPipeline();
+
+  ActorLearnerPipeline(const ActorLearnerPipeline&) = delete;
+  ActorLearnerPipeline& operator=(const ActorLearnerPipeline&) = delete;
+
+  /*!
+   * @brief Publishes the current weights of the learner and starts the
+   * collector thread.
+   */
+  void Start();
+
+  /*!
+   * @brief Stops the collector thread. Waits for the rollout being collected
+   * to finish.
+   */
+  void Stop();
+
+  /*!
+   * @brief Waits for the oldest collected rollout, trains the networks on it
+   * with the trainer and publishes the new weights to the collector.
+   *
+   * @pre Start() has been called.
+   *
+   * @throws The exception thrown by the collector thread, if it failed.
+   */
+  PipelineStep Step();
+
+ protected:
+  /*!
+   * @brief A collected rollout waiting to be trained on.
+   */
+  struct CollectedRollout {
+    RolloutStorage rollout;
+    int64_t weights_version;
+  };
+
+  /*!
+   * @brief Weights of the policy and critic network at one version.
+   */
+  struct WeightSnapshot {
+    std::vector<torch::Tensor> policy_parameters;
+    std::vector<torch::Tensor> critic_parameters;
+    int64_t version;
+  };
+
+  /*!
+   * @brief Loop of the collector thread.
+   */
+  void CollectLoop();
+
+  /*!
+   * @brief Copies the current weights of the learner into a new snapshot and
+   * publishes it together with the number of updates done.
+   */
+  void PublishWeights(int64_t updates_done);
+
+  /*!
+   * @brief Copies the weights of a snapshot into the networks of the
+   * collector.
+   */
+  void LoadWeights(const WeightSnapshot& snapshot);
+
+  /*!
+   * @brief Runner collecting the rollouts.
+   */
+  VectorizedRunner& runner_;
+
+  /*!
+   * @brief Trainer of the networks.
+   */
+  MappoTrainer& trainer_;
+
+  /*!
+   * @brief Policy network used by the collector.
+   */
+  PolicyNetwork actor_policy_;
+
+  /*!
+   * @brief Critic network used by the collector.
+   */
+  CriticNetwork actor_critic_;
+
+  /*!
+   * @brief Number of episodes per environment in each rollout.
+   */
+  int64_t episodes_per_environment_;
+
+  /*!
+   * @brief Maximum number of updates between collecting a rollout and
+   * training on it.
+   */
+  int64_t max_staleness_;
+
+  /*!
+   * @brief Called on the collector thread before each rollout.
+   */
+  std::function<void()> prepare_rollout_;
+
+  /*!
+   * @brief The collector thread.
+   */
+  std::thread collector_thread_;
+
+  /*!
+   * @brief Protects the members below.
+   */
+  std::mutex mutex_;
+
+  /*!
+   * @brief Signalled when a rollout is collected or the collector fails.
+   */
+  std::condition_variable rollout_collected_;
+
+  /*!
+   * @brief Signalled when new weights are published or the pipeline stops.
+   */
+  std::condition_variable weights_published_;
+
+  /*!
+   * @brief Rollouts waiting to be trained on, oldest first.
+   */
+  std::deque<CollectedRollout> collected_rollouts_;
+
+  /*!
+   * @brief Latest published weights, the collector swaps them in between
+   * rollouts.
+   */
+  std::shared_ptr<const WeightSnapshot> latest_weights_;
+
+  /*!
+   * @brief Number of updates done by the learner.
+   */
+  int64_t updates_done_;
+
+  /*!
+   * @brief Set when the collector should stop.
+   */
+  bool stopping_;
+
+  /*!
+   * @brief Exception thrown by the collector thread.
+   */
+  std::exception_ptr collector_error_;
+};
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_ACTORLEARNERPIPELINE_H_ */
@@ -11,9 +11,12 @@
 #include "communication.h"
 #include "../../src/common_types.h"
 #include "../../src/simulation-interface/simulation_interface.h"
+#include "../../src/simulation-interface/team_command_channel.h"
 #include "../../src/ssl-interface/automated_referee.h"
 #include "network.h"
+#include "phase_timer.h"
 #include "reward.h"
+#include "span"
 #include "torch/torch.h"
 #include "vector"
 
@@ -23,7 +26,7 @@ namespace collective_robot_behaviour
 {
 
 /* Utility function for calculating the goal difference. */
-static int32_t ComputeGoalDifference(ssl_interface::AutomatedReferee referee,
+static int32_t ComputeGoalDifference(ssl_interface::AutomatedReferee& referee,
                                      Team team) {
   switch (team) {
   case Team::kBlue:
@@ -54,17 +57,49 @@ torch::Tensor GetLocalState(ssl_interface::VisionClient& vision_client,
   return states.view({1, 1, states.size(0)});
 }
 
+torch::Tensor ComputeLocalStates(const torch::Tensor& kGlobalStates) {
+  /* Indices into the global state of the local state of each robot:
+   * [position x, position y, orientation, ball position x, ball position y].
+   */
+  std::vector<int64_t> indices;
+  indices.reserve(amount_of_players_in_team * num_local_states);
+  for (int64_t id = 0; id < amount_of_players_in_team; id++) {
+    indices.push_back(3 + 2 * id);
+    indices.push_back(3 + 2 * id + 1);
+    indices.push_back(15 + id);
+    indices.push_back(1);
+    indices.push_back(2);
+  }
+
+  torch::Tensor index_tensor = torch::tensor(indices, torch::kLong);
+  torch::Tensor local_states = kGlobalStates.index_select(-1, index_tensor);
+
+  std::vector<int64_t> shape = kGlobalStates.sizes().vec();
+  shape.back() = amount_of_players_in_team;
+  shape.push_back(num_local_states);
+
+  return local_states.view(shape);
+}
+
 torch::Tensor GetGlobalState(ssl_interface::AutomatedReferee& referee,
                              ssl_interface::VisionClient& vision_client,
                              Team own_team, Team opponent_team) {
-  /* Important! Both ReceivePacket() and AnalyzeGameState() should ideally be on
-     the same thread, but separate one. Not on the main thread as they are now.
-     This is because ReceivePacket() is a blocking call and will wait for the
-     next packet to arrive.
+  /* Important! ReceivePacket() is a blocking call and will wait for the next
+     packet to arrive, which also paces the rollout to the vision frame rate.
+     If the vision client receives in background (StartBackgroundReceive()),
+     it instead returns the latest frame straight away, and every getter below
+     reads that same frame.
   */
-  vision_client.ReceivePacket();
-  referee.AnalyzeGameState();
+  {
+    CENTRALISEDAI_TIME_PHASE(Phase::kReceive);
+    vision_client.ReceivePacket();
+  }
+  {
+    CENTRALISEDAI_TIME_PHASE(Phase::kReferee);
+    referee.AnalyzeGameState();
+  }
 
+  CENTRALISEDAI_TIME_PHASE(Phase::kState);
   torch::Tensor states = torch::zeros(21);
 
   /* Reserved for the robot id */
@@ -115,8 +150,8 @@ Team ComputeOpponentTeam(Team own_team) {
 }
 
 void SendActions(
-    std::vector<simulation_interface::SimulationInterface> robot_interfaces,
-    torch::Tensor action_ids) {
+    std::span<simulation_interface::SimulationInterface> robot_interfaces,
+    const torch::Tensor& action_ids) {
   for (int32_t i = 0; i < action_ids.size(0); i++) {
     switch (action_ids[i].item<int>()) {
     case 0: /* Forward */
@@ -145,5 +180,39 @@ void SendActions(
   }
 }
 
+void SendActions(simulation_interface::TeamCommandChannel& channel,
+                 const torch::Tensor& action_ids) {
+  torch::Tensor ids = action_ids.to(torch::kInt64).contiguous();
+  const int64_t* id_data = ids.data_ptr<int64_t>();
+
+  for (int32_t i = 0; i < ids.size(0); i++) {
+    switch (id_data[i]) {
+    case 0: /* Forward */
+      channel.SetVelocity(i, 0.5F, 0.0F, 0.0F);
+      break;
+    case 1: /* Backward */
+      channel.SetVelocity(i, -0.5F, 0.0F, 0.0F);
+      break;
+    case 2: /* Left */
+      channel.SetVelocity(i, 0.0F, 0.5F, 0.0F);
+      break;
+    case 3: /* Right */
+      channel.SetVelocity(i, 0.0F, -0.5F, 0.0F);
+      break;
+    case 4: /* Rotate anti-clockwise */
+      channel.SetVelocity(i, 0.0F, 0.0F, 1.0F);
+      break;
+    case 5: /* Rotate clockwise */
+      channel.SetVelocity(i, 0.0F, 0.0F, -1.0F);
+      break;
+    default:
+      break;
+    }
+  }
+
+  /* The commands of all robots go out together */
+  channel.SendPacket();
+}
+
 } /* namespace collective_robot_behaviour */
 } /* namespace centralised_ai */
@@ -14,9 +14,11 @@
 
 #include "../../src/common_types.h"
 #include "../../src/simulation-interface/simulation_interface.h"
+#include "../../src/simulation-interface/team_command_channel.h"
 #include "../../src/ssl-interface/automated_referee.h"
 #include "network.h"
 #include "reward.h"
+#include "span"
 #include "torch/torch.h"
 #include "vector"
 
@@ -125,6 +127,17 @@ torch::Tensor GetGlobalState(ssl_interface::AutomatedReferee& referee,
 torch::Tensor GetLocalState(ssl_interface::VisionClient& vision_client,
                             Team own_team, int robot_id);
 
+/*!
+ *	@brief Extracts the local states of all robots in the own team from global
+ *	states, without querying the vision client.
+ *	@returns A tensor representing the local states of all robots, with the
+ *	shape [..., amount_of_players_in_team, num_local_states]. The values are
+ *	the same as those returned by GetLocalState for the same world state.
+ *	@param[in] kGlobalStates: Global states as returned by GetGlobalState, with
+ *	the shape [..., num_global_states].
+ */
+torch::Tensor ComputeLocalStates(const torch::Tensor& kGlobalStates);
+
 /*!
  *	@brief Send actions to the robots.
  *
@@ -133,8 +146,19 @@ torch::Tensor GetLocalState(ssl_interface::VisionClient& vision_client,
  *	robots.
  */
 void SendActions(
-    std::vector<simulation_interface::SimulationInterface> robot_interfaces,
-    torch::Tensor action_ids);
+    std::span<simulation_interface::SimulationInterface> robot_interfaces,
+    const torch::Tensor& action_ids);
+
+/*!
+ *	@brief Send actions to the robots of a team in one packet.
+ *
+ *	@param[in] channel: Command channel of the team. Robot i is sent
+ *	action_ids[i].
+ *	@param[in] action_ids: The ids of the actions which will be sent to all
+ *	robots.
+ */
+void SendActions(simulation_interface::TeamCommandChannel& channel,
+                 const torch::Tensor& action_ids);
 
 } /* namespace collective_robot_behaviour */
 } /* namespace centralised_ai */
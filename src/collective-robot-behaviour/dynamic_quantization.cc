@@ -0,0 +1,233 @@
+/* dynamic_quantization.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Copies of the policy and critic network with dynamically
+ * quantized int8 weights, for collecting rollouts on the CPU.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "dynamic_quantization.h"
+#include "../../src/common_types.h"
+#include "ATen/core/dispatch/Dispatcher.h"
+#include "ATen/native/quantized/PackedParams.h"
+#include "algorithm"
+#include "chrono"
+#include "optional"
+#include "network.h"
+#include "policy_quantization.h"
+#include "rollout_storage.h"
+#include "stdexcept"
+#include "stdint.h"
+#include "string"
+#include "torch/torch.h"
+#include "tuple"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* True if libtorch was built with a quantized engine, such as FBGEMM or
+ * QNNPACK, for the quantized:: operators */
+static bool IsQuantizedEngineAvailable() {
+  for (at::QEngine engine : at::globalContext().supportedQEngines()) {
+    if (engine != at::QEngine::NoQEngine) {
+      return true;
+    }
+  }
+  return false;
+}
+
+DynamicQuantizedLinear::DynamicQuantizedLinear(const torch::Tensor& kWeight,
+                                               const torch::Tensor& kBias) {
+  if (!IsQuantizedEngineAvailable()) {
+    throw std::runtime_error("Int8 inference is not supported on this CPU");
+  }
+
+  torch::NoGradGuard no_grad;
+  torch::Tensor weight = kWeight.detach().to(torch::kFloat).contiguous();
+
+  /* Symmetric int8 weights with one scale for the whole matrix, as the
+   * default weight observer of dynamic quantization */
+  double scale = std::max(weight.abs().max().item<double>() / 127.5, 1e-8);
+  torch::Tensor quantized_weight =
+      torch::quantize_per_tensor(weight, scale, 0, torch::kQInt8);
+
+  static auto prepack =
+      c10::Dispatcher::singleton()
+          .findSchemaOrThrow("quantized::linear_prepack", "")
+          .typed<c10::intrusive_ptr<LinearPackedParamsBase>(
+              at::Tensor, std::optional<at::Tensor>)>();
+  packed_weight_ = prepack.call(quantized_weight,
+                                kBias.detach().to(torch::kFloat).contiguous());
+}
+
+DynamicQuantizedLinear::DynamicQuantizedLinear(
+    const torch::nn::Linear& kLinear)
+    : DynamicQuantizedLinear(kLinear->weight, kLinear->bias) {}
+
+torch::Tensor DynamicQuantizedLinear::Forward(
+    const torch::Tensor& kInput) const {
+  /* The input range is reduced to 7 bits, as in torch.ao dynamic Linear,
+   * so the int8 products cannot saturate the int16 accumulation of FBGEMM */
+  static auto linear_dynamic =
+      c10::Dispatcher::singleton()
+          .findSchemaOrThrow("quantized::linear_dynamic", "")
+          .typed<at::Tensor(at::Tensor,
+                            const c10::intrusive_ptr<LinearPackedParamsBase>&,
+                            bool)>();
+  return linear_dynamic.call(kInput.contiguous(), packed_weight_, true);
+}
+
+/* The first layer weights of a GRU, by name */
+static torch::Tensor GetGruParameter(const torch::nn::GRU& kGru,
+                                     const std::string& kName) {
+  return kGru->named_parameters()[kName];
+}
+
+DynamicQuantizedGruCell::DynamicQuantizedGruCell(const torch::nn::GRU& kGru)
+    : input_weights_(GetGruParameter(kGru, "weight_ih_l0"),
+                     GetGruParameter(kGru, "bias_ih_l0")),
+      hidden_weights_(GetGruParameter(kGru, "weight_hh_l0"),
+                      GetGruParameter(kGru, "bias_hh_l0")) {}
+
+torch::Tensor
+DynamicQuantizedGruCell::Forward(const torch::Tensor& kInput,
+                                 const torch::Tensor& kHiddenStates) const {
+  std::vector<torch::Tensor> input_gates =
+      input_weights_.Forward(kInput).chunk(3, 1);
+  std::vector<torch::Tensor> hidden_gates =
+      hidden_weights_.Forward(kHiddenStates).chunk(3, 1);
+
+  /* r, z = sigmoid(W_i x + b_i + W_h h + b_h)
+   * n = tanh(W_in x + b_in + r * (W_hn h + b_hn))
+   * h' = n + z * (h - n) */
+  torch::Tensor reset = (input_gates[0] + hidden_gates[0]).sigmoid_();
+  torch::Tensor update = (input_gates[1] + hidden_gates[1]).sigmoid_();
+  torch::Tensor candidate =
+      input_gates[2].addcmul(reset, hidden_gates[2]).tanh_();
+
+  return candidate + update * (kHiddenStates - candidate);
+}
+
+DynamicQuantizedPolicy::DynamicQuantizedPolicy(const PolicyNetwork& kPolicy)
+    : layer1_weight_(kPolicy.layer1->weight.detach().clone()),
+      layer1_bias_(kPolicy.layer1->bias.detach().clone()),
+      layer2_(kPolicy.layer2), rnn_(kPolicy.rnn),
+      output_layer_(kPolicy.output_layer) {}
+
+std::tuple<torch::Tensor, torch::Tensor>
+DynamicQuantizedPolicy::Forward(const torch::Tensor& kInput,
+                                const torch::Tensor& kHiddenStates) const {
+  torch::Tensor layer1_output =
+      torch::addmm(layer1_bias_, kInput, layer1_weight_.t()).tanh_();
+  torch::Tensor layer2_output = layer2_.Forward(layer1_output).tanh_();
+  torch::Tensor hidden_states = rnn_.Forward(layer2_output, kHiddenStates);
+
+  return std::make_tuple(output_layer_.Forward(hidden_states), hidden_states);
+}
+
+DynamicQuantizedCritic::DynamicQuantizedCritic(const CriticNetwork& kCritic)
+    : layer1_weight_(kCritic.layer1->weight.detach().clone()),
+      layer1_bias_(kCritic.layer1->bias.detach().clone()),
+      layer2_(kCritic.layer2), rnn_(kCritic.rnn),
+      output_layer_(kCritic.output_layer) {}
+
+std::tuple<torch::Tensor, torch::Tensor>
+DynamicQuantizedCritic::Forward(const torch::Tensor& kInput,
+                                const torch::Tensor& kHiddenStates) const {
+  torch::Tensor layer1_output =
+      torch::addmm(layer1_bias_, kInput, layer1_weight_.t()).relu_();
+  torch::Tensor layer2_output = layer2_.Forward(layer1_output).relu_();
+
+  /* The critic squashes its hidden state, as in CriticNetwork::Forward */
+  torch::Tensor hidden_states =
+      rnn_.Forward(layer2_output, kHiddenStates).tanh_();
+
+  return std::make_tuple(output_layer_.Forward(hidden_states), hidden_states);
+}
+
+QuantizedInferenceReport EvaluateQuantizedInference(
+    PolicyNetwork& policy, CriticNetwork& critic,
+    const RolloutStorage& kRollout) {
+  torch::NoGradGuard no_grad;
+
+  /* [T, robots, num_local_states] and [T, episodes, num_global_states], with
+   * the critic input as during collection */
+  torch::Tensor local_states = ComputeCalibrationStates(kRollout);
+  torch::Tensor global_states = kRollout.GetStates().transpose(0, 1).clone();
+  global_states.select(2, 0).fill_(-1);
+  int64_t num_time_steps = local_states.size(0);
+  int64_t num_robots = local_states.size(1);
+  int64_t num_episodes = global_states.size(1);
+
+  DynamicQuantizedPolicy quantized_policy(policy);
+  DynamicQuantizedCritic quantized_critic(critic);
+
+  std::vector<torch::Tensor> float_actions;
+  std::vector<torch::Tensor> float_values;
+  torch::Tensor policy_hidden_states =
+      torch::zeros({1, num_robots, hidden_size});
+  torch::Tensor critic_hidden_states =
+      torch::zeros({1, num_episodes, hidden_size});
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (int64_t t = 0; t < num_time_steps; t++) {
+    std::tuple<torch::Tensor, torch::Tensor> policy_value =
+        policy.Forward(local_states[t].unsqueeze(0), policy_hidden_states);
+    policy_hidden_states = std::get<1>(policy_value);
+    float_actions.push_back(std::get<0>(policy_value).squeeze(0).argmax(1));
+
+    std::tuple<torch::Tensor, torch::Tensor> critic_value =
+        critic.Forward(global_states[t].unsqueeze(0), critic_hidden_states);
+    critic_hidden_states = std::get<1>(critic_value);
+    float_values.push_back(std::get<0>(critic_value).reshape({num_episodes}));
+  }
+  std::chrono::duration<double> float_time =
+      std::chrono::steady_clock::now() - start;
+
+  std::vector<torch::Tensor> quantized_actions;
+  std::vector<torch::Tensor> quantized_values;
+  policy_hidden_states = torch::zeros({num_robots, hidden_size});
+  critic_hidden_states = torch::zeros({num_episodes, hidden_size});
+  start = std::chrono::steady_clock::now();
+  for (int64_t t = 0; t < num_time_steps; t++) {
+    std::tuple<torch::Tensor, torch::Tensor> policy_value =
+        quantized_policy.Forward(local_states[t], policy_hidden_states);
+    policy_hidden_states = std::get<1>(policy_value);
+    quantized_actions.push_back(std::get<0>(policy_value).argmax(1));
+
+    std::tuple<torch::Tensor, torch::Tensor> critic_value =
+        quantized_critic.Forward(global_states[t], critic_hidden_states);
+    critic_hidden_states = std::get<1>(critic_value);
+    quantized_values.push_back(
+        std::get<0>(critic_value).reshape({num_episodes}));
+  }
+  std::chrono::duration<double> quantized_time =
+      std::chrono::steady_clock::now() - start;
+
+  double num_agent_steps = static_cast<double>(num_time_steps * num_robots);
+
+  QuantizedInferenceReport report;
+  report.action_agreement = torch::stack(float_actions)
+                                .eq(torch::stack(quantized_actions))
+                                .to(torch::kDouble)
+                                .mean()
+                                .item<double>();
+  report.value_error =
+      (torch::stack(float_values) - torch::stack(quantized_values))
+          .abs()
+          .mean()
+          .item<double>();
+  report.float_steps_per_second = num_agent_steps / float_time.count();
+  report.quantized_steps_per_second = num_agent_steps / quantized_time.count();
+
+  return report;
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
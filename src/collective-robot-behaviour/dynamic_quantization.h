@@ -0,0 +1,233 @@
+/* dynamic_quantization.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Copies of the policy and critic network with dynamically
+ * quantized int8 weights, for collecting rollouts on the CPU.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_DYNAMICQUANTIZATION_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_DYNAMICQUANTIZATION_H_
+
+#include "ATen/native/quantized/PackedParams.h"
+#include "network.h"
+#include "rollout_storage.h"
+#include "stdint.h"
+#include "torch/torch.h"
+#include "tuple"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief A Linear layer with int8 weights and float inputs and outputs.
+ *
+ * The weights are quantized once, with one scale for the whole matrix, and
+ * packed with quantized::linear_prepack. Every call runs
+ * quantized::linear_dynamic, which quantizes the input with a scale computed
+ * from its range, multiplies in int8 with int32 accumulation and returns the
+ * dequantized output plus the float bias.
+ */
+class DynamicQuantizedLinear
+{
+ public:
+  /*!
+   * @brief Constructor that quantizes a weight matrix.
+   *
+   * @param[in] kWeight The weights, [outputs, inputs].
+   *
+   * @param[in] kBias The biases, [outputs].
+   *
+   * @throws std::runtime_error if libtorch has no quantized engine for this
+   * CPU.
+   */
+  DynamicQuantizedLinear(const torch::Tensor& kWeight,
+                         const torch::Tensor& kBias);
+
+  /*!
+   * @brief Constructor that quantizes a Linear layer.
+   */
+  explicit DynamicQuantizedLinear(const torch::nn::Linear& kLinear);
+
+  /*!
+   * @brief Computes input W^T + b, with input [batch, inputs].
+   */
+  torch::Tensor Forward(const torch::Tensor& kInput) const;
+
+ protected:
+  /*!
+   * @brief Packed int8 weights and float biases, as returned by
+   * quantized::linear_prepack.
+   */
+  c10::intrusive_ptr<LinearPackedParamsBase> packed_weight_;
+};
+
+/*!
+ * @brief One step of a single layer GRU with int8 weights, with the gates in
+ * the order of torch::nn::GRU.
+ */
+class DynamicQuantizedGruCell
+{
+ public:
+  /*!
+   * @brief Constructor that quantizes the first layer of a GRU.
+   */
+  explicit DynamicQuantizedGruCell(const torch::nn::GRU& kGru);
+
+  /*!
+   * @brief Computes the next hidden states, [batch, hidden_size], from the
+   * input [batch, inputs] and hidden states [batch, hidden_size].
+   */
+  torch::Tensor Forward(const torch::Tensor& kInput,
+                        const torch::Tensor& kHiddenStates) const;
+
+ protected:
+  /*!
+   * @brief Weights of the input and of the hidden state.
+   */
+  DynamicQuantizedLinear input_weights_;
+  DynamicQuantizedLinear hidden_weights_;
+};
+
+/*!
+ * @brief The policy network with int8 weights in every layer but the first.
+ *
+ * The first layer takes the raw local states, positions in mm next to
+ * orientations in radians, which one dynamic input scale would round the
+ * orientations away from. It is small, so it stays in float.
+ *
+ * A snapshot: later changes to the policy it was created from are not seen.
+ */
+class DynamicQuantizedPolicy
+{
+ public:
+  /*!
+   * @brief Constructor that quantizes a policy.
+   */
+  explicit DynamicQuantizedPolicy(const PolicyNetwork& kPolicy);
+
+  /*!
+   * @brief Runs one time step.
+   *
+   * @param[in] kInput Local states, [batch, num_local_states].
+   *
+   * @param[in] kHiddenStates Hidden states, [batch, hidden_size].
+   *
+   * @returns A tuple with the values (Outputs before the softmax, [batch,
+   * num_actions], next hidden states, [batch, hidden_size]), as
+   * PolicyNetwork::Forward returns them.
+   */
+  std::tuple<torch::Tensor, torch::Tensor>
+  Forward(const torch::Tensor& kInput,
+          const torch::Tensor& kHiddenStates) const;
+
+ protected:
+  /*!
+   * @brief The float weights and biases of the first layer.
+   */
+  torch::Tensor layer1_weight_;
+  torch::Tensor layer1_bias_;
+
+  /*!
+   * @brief The quantized layers of the policy.
+   */
+  DynamicQuantizedLinear layer2_;
+  DynamicQuantizedGruCell rnn_;
+  DynamicQuantizedLinear output_layer_;
+};
+
+/*!
+ * @brief The critic network with int8 weights in every layer but the first,
+ * which stays in float for the same reason as in DynamicQuantizedPolicy.
+ *
+ * A snapshot: later changes to the critic it was created from are not seen.
+ */
+class DynamicQuantizedCritic
+{
+ public:
+  /*!
+   * @brief Constructor that quantizes a critic.
+   */
+  explicit DynamicQuantizedCritic(const CriticNetwork& kCritic);
+
+  /*!
+   * @brief Runs one time step.
+   *
+   * @param[in] kInput Global states, [batch, num_global_states].
+   *
+   * @param[in] kHiddenStates Hidden states, [batch, hidden_size].
+   *
+   * @returns A tuple with the values (Values, [batch, 1], next hidden states,
+   * [batch, hidden_size]), as CriticNetwork::Forward returns them.
+   */
+  std::tuple<torch::Tensor, torch::Tensor>
+  Forward(const torch::Tensor& kInput,
+          const torch::Tensor& kHiddenStates) const;
+
+ protected:
+  /*!
+   * @brief The float weights and biases of the first layer.
+   */
+  torch::Tensor layer1_weight_;
+  torch::Tensor layer1_bias_;
+
+  /*!
+   * @brief The quantized layers of the critic.
+   */
+  DynamicQuantizedLinear layer2_;
+  DynamicQuantizedGruCell rnn_;
+  DynamicQuantizedLinear output_layer_;
+};
+
+/*!
+ * @brief How closely and how fast the quantized networks reproduce the float
+ * networks.
+ */
+struct QuantizedInferenceReport {
+  /*!
+   * @brief Fraction of agent time steps in which the quantized policy
+   * selects the action of the float policy.
+   */
+  double action_agreement;
+
+  /*!
+   * @brief Mean absolute difference of the values of the two critics.
+   */
+  double value_error;
+
+  /*!
+   * @brief Agent time steps per second through the float policy and critic.
+   */
+  double float_steps_per_second;
+
+  /*!
+   * @brief Agent time steps per second through the quantized policy and
+   * critic.
+   */
+  double quantized_steps_per_second;
+};
+
+/*!
+ * @brief Runs the float and the quantized networks over the states of a
+ * rollout, one time step at a time with all episodes as the batch as during
+ * collection, and compares them.
+ *
+ * @param[in] policy The float policy network.
+ *
+ * @param[in] critic The float critic network.
+ *
+ * @param[in] kRollout The rollout whose states are replayed.
+ */
+QuantizedInferenceReport EvaluateQuantizedInference(
+    PolicyNetwork& policy, CriticNetwork& critic,
+    const RolloutStorage& kRollout);
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_DYNAMICQUANTIZATION_H_ */
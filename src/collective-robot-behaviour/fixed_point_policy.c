@@ -0,0 +1,161 @@
+/* fixed_point_policy.c
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Fixed-point inference of the policy network in C, without
+ * floating point math or dynamic allocation, for the robot microcontrollers.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "fixed_point_policy.h"
+#include "stdint.h"
+
+/* Shifts right with rounding, or left for a negative shift */
+static int32_t ShiftRound(int32_t value, int shift) {
+  if (shift > 0) {
+    return (value + ((int32_t)1 << (shift - 1))) >> shift;
+  }
+
+  return value * ((int32_t)1 << -shift);
+}
+
+static int32_t Clamp(int32_t value, int32_t min, int32_t max) {
+  return value < min ? min : (value > max ? max : value);
+}
+
+/* Reads a function at x in Q3.12 from its table, with linear interpolation
+ * between the entries. Outside [-8, 8) the function is taken as constant. */
+static int16_t Lookup(const int16_t* table, int32_t x) {
+  int32_t index = Clamp(x, INT16_MIN, INT16_MAX) - INT16_MIN;
+  int32_t low = table[index >> 8];
+  int32_t high = table[(index >> 8) + 1];
+
+  return (int16_t)(low + (((high - low) * (index & 255) + 128) >> 8));
+}
+
+/* Computes the Q3.12 outputs of a layer, before the activation */
+static void RunLayer(const FixedPointLayer* layer, const int16_t* input,
+                     int32_t* output) {
+  int r;
+  int c;
+
+  for (r = 0; r < layer->rows; r++) {
+    const int8_t* weights = layer->weights + r * layer->cols;
+    int32_t sum = layer->biases[r];
+    for (c = 0; c < layer->cols; c++) {
+      sum += (int32_t)weights[c] * input[c];
+    }
+    output[r] = ShiftRound(sum, layer->shifts[r]);
+  }
+}
+
+/* Computes a layer followed by tanh */
+static void RunTanhLayer(const FixedPointLayer* layer, const int16_t* table,
+                         const int16_t* input, int16_t* output) {
+  int32_t sums[FIXED_POINT_POLICY_MAX_ROWS];
+  int r;
+
+  RunLayer(layer, input, sums);
+  for (r = 0; r < layer->rows; r++) {
+    output[r] = Lookup(table, sums[r]);
+  }
+}
+
+int16_t FixedPointPolicyQuantizeInput(const FixedPointPolicy* model,
+                                      int index, float value) {
+  int frac_bits = model->input_frac_bits[index];
+  float scaled = value;
+  int i;
+
+  for (i = 0; i < frac_bits; i++) {
+    scaled *= 2.0F;
+  }
+  for (i = 0; i > frac_bits; i--) {
+    scaled *= 0.5F;
+  }
+
+  if (scaled >= (float)INT16_MAX) {
+    return INT16_MAX;
+  }
+  if (scaled <= (float)INT16_MIN) {
+    return INT16_MIN;
+  }
+
+  return (int16_t)(scaled >= 0.0F ? scaled + 0.5F : scaled - 0.5F);
+}
+
+int FixedPointPolicyForward(const FixedPointPolicy* model,
+                            const int16_t* local_state, int16_t* hidden_state,
+                            int32_t* logits) {
+  int16_t layer1_output[FIXED_POINT_POLICY_MAX_ROWS];
+  int16_t layer2_output[FIXED_POINT_POLICY_MAX_ROWS];
+  int32_t input_gates[FIXED_POINT_POLICY_MAX_ROWS];
+  int32_t hidden_gates[FIXED_POINT_POLICY_MAX_ROWS];
+  const int32_t kOne = (int32_t)1 << FIXED_POINT_POLICY_FRAC_BITS;
+  int hidden_size = model->hidden_size;
+  int i;
+
+  if (model->layer1.rows > FIXED_POINT_POLICY_MAX_ROWS ||
+      model->layer2.rows > FIXED_POINT_POLICY_MAX_ROWS ||
+      model->gru_input.rows > FIXED_POINT_POLICY_MAX_ROWS ||
+      model->gru_hidden.rows > FIXED_POINT_POLICY_MAX_ROWS) {
+    return -1;
+  }
+
+  RunTanhLayer(&model->layer1, model->tanh_table, local_state, layer1_output);
+  RunTanhLayer(&model->layer2, model->tanh_table, layer1_output,
+               layer2_output);
+
+  /* One GRU step:
+   * r = sigmoid(W_ir x + b_ir + W_hr h + b_hr)
+   * z = sigmoid(W_iz x + b_iz + W_hz h + b_hz)
+   * n = tanh(W_in x + b_in + r * (W_hn h + b_hn))
+   * h' = n + z * (h - n) */
+  RunLayer(&model->gru_input, layer2_output, input_gates);
+  RunLayer(&model->gru_hidden, hidden_state, hidden_gates);
+  for (i = 0; i < hidden_size; i++) {
+    int32_t reset =
+        Lookup(model->sigmoid_table, input_gates[i] + hidden_gates[i]);
+    int32_t update =
+        Lookup(model->sigmoid_table,
+               input_gates[hidden_size + i] + hidden_gates[hidden_size + i]);
+
+    /* Limited to +-64 so the product with reset fits in 32 bits */
+    int32_t hidden_new =
+        Clamp(hidden_gates[2 * hidden_size + i], -64 * kOne, 64 * kOne);
+    int32_t candidate = Lookup(
+        model->tanh_table,
+        input_gates[2 * hidden_size + i] +
+            ShiftRound(reset * hidden_new, FIXED_POINT_POLICY_FRAC_BITS));
+
+    hidden_state[i] = (int16_t)(
+        candidate + ShiftRound(update * (hidden_state[i] - candidate),
+                               FIXED_POINT_POLICY_FRAC_BITS));
+  }
+
+  RunLayer(&model->output, hidden_state, logits);
+
+  return 0;
+}
+
+int FixedPointPolicyAct(const FixedPointPolicy* model,
+                        const int16_t* local_state, int16_t* hidden_state) {
+  int32_t logits[FIXED_POINT_POLICY_MAX_ROWS];
+  int action = 0;
+  int i;
+
+  if (model->output.rows > FIXED_POINT_POLICY_MAX_ROWS ||
+      FixedPointPolicyForward(model, local_state, hidden_state, logits) != 0) {
+    return -1;
+  }
+
+  for (i = 1; i < model->num_actions; i++) {
+    if (logits[i] > logits[action]) {
+      action = i;
+    }
+  }
+
+  return action;
+}
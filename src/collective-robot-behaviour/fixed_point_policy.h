@@ -0,0 +1,176 @@
+/* fixed_point_policy.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Fixed-point inference of the policy network in C, without
+ * floating point math or dynamic allocation, for the robot microcontrollers.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_FIXEDPOINTPOLICY_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_FIXEDPOINTPOLICY_H_
+
+#include "stdint.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Number of fractional bits of the activations and hidden states,
+ * which are int16 in Q3.12.
+ */
+#define FIXED_POINT_POLICY_FRAC_BITS 12
+
+/*!
+ * @brief Number of entries in the tanh and sigmoid tables, which sample
+ * [-8, 8] in steps of 1/16.
+ */
+#define FIXED_POINT_POLICY_TABLE_SIZE 257
+
+/*!
+ * @brief Largest number of outputs of a layer, 3 * hidden_size for the GRU
+ * gates. Sets the size of the arrays on the stack of
+ * FixedPointPolicyForward().
+ */
+#ifndef FIXED_POINT_POLICY_MAX_ROWS
+#define FIXED_POINT_POLICY_MAX_ROWS 192
+#endif
+
+/*!
+ * @brief A Linear layer with int8 weights.
+ *
+ * Output row r is (biases[r] + sum_c weights[r][c] * input[c]) shifted right
+ * by shifts[r], in Q3.12. The shift is negative for a left shift. Every row
+ * has its own power of two scale, so the shifts differ between rows.
+ */
+typedef struct {
+  /*!
+   * @brief Number of outputs.
+   */
+  int16_t rows;
+
+  /*!
+   * @brief Number of inputs.
+   */
+  int16_t cols;
+
+  /*!
+   * @brief Weights, row-major [rows, cols].
+   */
+  const int8_t* weights;
+
+  /*!
+   * @brief Biases, at the scale of the sums of their rows.
+   */
+  const int32_t* biases;
+
+  /*!
+   * @brief Right shift from the sum of each row to Q3.12.
+   */
+  const int8_t* shifts;
+} FixedPointLayer;
+
+/*!
+ * @brief A policy with the architecture of PolicyNetwork, quantized by
+ * QuantizedPolicy.
+ */
+typedef struct {
+  /*!
+   * @brief Number of local states, hidden states and actions.
+   */
+  int16_t num_inputs;
+  int16_t hidden_size;
+  int16_t num_actions;
+
+  /*!
+   * @brief Number of fractional bits of each of the num_inputs int16 local
+   * states, which differ since positions are in mm and orientations in
+   * radians. The weights of layer1 are scaled per column to match.
+   */
+  const int8_t* input_frac_bits;
+
+  /*!
+   * @brief The two input layers, followed by tanh.
+   */
+  FixedPointLayer layer1;
+  FixedPointLayer layer2;
+
+  /*!
+   * @brief The GRU weights of the input and of the hidden state, with the
+   * gates in the order reset, update, new as in torch::nn::GRU.
+   */
+  FixedPointLayer gru_input;
+  FixedPointLayer gru_hidden;
+
+  /*!
+   * @brief The output layer.
+   */
+  FixedPointLayer output;
+
+  /*!
+   * @brief tanh and sigmoid at -8 + i / 16, in Q3.12.
+   */
+  const int16_t* tanh_table;
+  const int16_t* sigmoid_table;
+} FixedPointPolicy;
+
+/*!
+ * @brief Converts a local state to the int16 fixed point input of a policy,
+ * with saturation.
+ *
+ * @param[in] model The quantized policy.
+ *
+ * @param[in] index Index of the local state, in [0, num_inputs).
+ *
+ * @param[in] value The local state.
+ */
+int16_t FixedPointPolicyQuantizeInput(const FixedPointPolicy* model,
+                                      int index, float value);
+
+/*!
+ * @brief Runs one time step of one robot.
+ *
+ * @param[in] model The quantized policy.
+ *
+ * @param[in] local_state The num_inputs local states of the robot, converted
+ * with FixedPointPolicyQuantizeInput().
+ *
+ * @param[in,out] hidden_state The hidden_size hidden states of the robot in
+ * Q3.12, zero at the start of an episode, which are replaced by those of the
+ * next time step.
+ *
+ * @param[out] logits The num_actions outputs of the policy in Q3.12, before
+ * the softmax.
+ *
+ * @returns 0, or -1 if a layer has more than FIXED_POINT_POLICY_MAX_ROWS
+ * outputs.
+ */
+int FixedPointPolicyForward(const FixedPointPolicy* model,
+                            const int16_t* local_state, int16_t* hidden_state,
+                            int32_t* logits);
+
+/*!
+ * @brief Runs one time step of one robot and selects its most probable
+ * action.
+ *
+ * @param[in] model The quantized policy.
+ *
+ * @param[in] local_state The num_inputs local states of the robot, converted
+ * with FixedPointPolicyQuantizeInput().
+ *
+ * @param[in,out] hidden_state The hidden_size hidden states of the robot.
+ *
+ * @returns The index of the action with the highest probability, or -1 if a
+ * layer has more than FIXED_POINT_POLICY_MAX_ROWS outputs.
+ */
+int FixedPointPolicyAct(const FixedPointPolicy* model,
+                        const int16_t* local_state, int16_t* hidden_state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_FIXEDPOINTPOLICY_H_ */
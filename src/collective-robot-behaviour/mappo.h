@@ -13,9 +13,11 @@
 
 #include "../../src/common_types.h"
 #include "../../src/simulation-interface/simulation_interface.h"
+#include "../../src/simulation-interface/team_command_channel.h"
 #include "chrono"
 #include "communication.h"
 #include "network.h"
+#include "rollout_storage.h"
 #include "run_state.h"
 #include "torch/torch.h"
 #include "tuple"
@@ -27,28 +29,18 @@ namespace centralised_ai
 namespace collective_robot_behaviour
 {
 
-/*!
- * @brief Resets hidden states and initializes trajectories for agents in a
- * MAPPO implementation.
- *
- * @return A tuple containing:
- * - A vector of `Trajectory` objects, each containing the reset hidden states
- * for all agents.
- *
- * - A tensor of zeros representing the initial action probabilities
- * (`act_prob`) for all actions.
- *
- * - An uninitialized tensor for storing the agent's actions.
- */
-std::tuple<std::vector<Trajectory>, torch::Tensor, torch::Tensor> ResetHidden();
-
 /*!
  * @brief Algorithm for training the networks.
  *
- * @details Global constant values is declared in common_types.h!
+ * @details Global constant values is declared in common_types.h! Takes one
+ * optimizer step with optimizers created for this call. Training loops should
+ * keep a MappoTrainer instead, whose optimizers persist between updates.
  *
  * @pre The following preconditions must be met before using this class:
  * - Saved or created models of policy and critic network is needed.
+ * - The rollout was collected with the networks being updated, or with
+ * earlier versions of them, whose action log-probabilities and values it
+ * recorded.
  *
  * @returns A tensor representing the loss of the networks, with the shape
  * [policy_loss, critic_loss].
@@ -59,17 +51,18 @@ std::tuple<std::vector<Trajectory>, torch::Tensor, torch::Tensor> ResetHidden();
  * @param[in] critic is the created/loaded ctritic network that the MAPPO will
  * be validating from.
  *
- * @param[in] data_buffer is the buffer that stores all the chunks of time steps
- * for updating the networks.
+ * @param[in] rollout is the storage of all the chunks of time steps for
+ * updating the networks.
  */
 torch::Tensor MappoUpdate(PolicyNetwork& policy, CriticNetwork& critic,
-                          std::vector<DataBuffer> data_buffer);
+                          const RolloutStorage& rollout);
 
 /*!
  * @brief Algorithm for stepping in the grSim environment and collecting the
  * data needed for training.
  *
- * @details Global constant values is declared in common_types.h!
+ * @details Global constant values is declared in common_types.h! Equivalent
+ * to VectorizedRunner with a single environment, which is how it is run.
  * @pre The following preconditions must be met before using this class:
  * - Saved or created models of policy and critic network is needed.
  *
@@ -87,15 +80,17 @@ torch::Tensor MappoUpdate(PolicyNetwork& policy, CriticNetwork& critic,
  *
  * @param[in] own_team is the team that the agents are in.
  *
- * @param[in] simulation_interfaces is the simulation interfaces representing
- * each robot in the game.
+ * @param[in] command_channel is the channel sending the commands of all robots
+ * of own_team to the simulation. It is kept open between calls.
+ *
+ * @returns The collected data of batch_size episodes, including the
+ * reward-to-go and general advantage estimation.
  */
-std::vector<DataBuffer>
+RolloutStorage
 MappoRun(PolicyNetwork& policy, CriticNetwork& critic,
          ssl_interface::AutomatedReferee& referee,
          ssl_interface::VisionClient& vision_client, Team own_team,
-         std::vector<simulation_interface::SimulationInterface>
-             simulation_interfaces);
+         simulation_interface::TeamCommandChannel& command_channel);
 
 /*!
  * @brief Utility function for checking if the network parameters match.
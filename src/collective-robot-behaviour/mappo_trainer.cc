@@ -0,0 +1,406 @@
+/* mappo_trainer.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Trainer that owns the optimizers of the networks and updates
+ * the networks on collected rollouts.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "mappo_trainer.h"
+#include "../../src/common_types.h"
+#include "communication.h"
+#include "mappo.h"
+#include "memory"
+#include "network.h"
+#include "optional"
+#include "phase_timer.h"
+#include "policy_export.h"
+#include "rollout_storage.h"
+#include "stdexcept"
+#include "stdint.h"
+#include "string"
+#include "torch/torch.h"
+#include "utils.h"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* A Linear layer on bfloat16 input, with bfloat16 copies of its weights
+ * that the gradients flow back through to the float32 weights */
+static torch::Tensor LinearBFloat16(const torch::nn::Linear& kLinear,
+                                    const torch::Tensor& kInput) {
+  return torch::linear(kInput, kLinear->weight.to(torch::kBFloat16),
+                       kLinear->bias.to(torch::kBFloat16));
+}
+
+/* bfloat16 copies of the weights of a GRU, in the order torch::gru takes */
+static std::vector<torch::Tensor> GruWeightsBFloat16(
+    const torch::nn::GRU& kGru) {
+  std::vector<torch::Tensor> weights;
+  for (const torch::Tensor& kWeight : kGru->all_weights()) {
+    weights.push_back(kWeight.to(torch::kBFloat16));
+  }
+
+  return weights;
+}
+
+/* PolicyNetwork::ForwardSequence in bfloat16, returning the float32 outputs
+ * before the softmax */
+static torch::Tensor ForwardPolicyBFloat16(PolicyNetwork& policy,
+                                           const torch::Tensor& kInput,
+                                           const torch::Tensor& kHx) {
+  torch::Tensor layer1_output =
+      LinearBFloat16(policy.layer1, kInput.to(torch::kBFloat16)).tanh();
+  torch::Tensor layer2_output =
+      LinearBFloat16(policy.layer2, layer1_output).tanh();
+  torch::Tensor gru_out = std::get<0>(
+      torch::gru(layer2_output, kHx.to(torch::kBFloat16),
+                 GruWeightsBFloat16(policy.rnn), true, 1, 0.0,
+                 policy.is_training(), false, false));
+
+  return LinearBFloat16(policy.output_layer, gru_out).to(torch::kFloat);
+}
+
+/* CriticNetwork::ForwardSequence in bfloat16, returning the float32 values */
+static torch::Tensor ForwardCriticBFloat16(CriticNetwork& critic,
+                                           const torch::Tensor& kInput,
+                                           const torch::Tensor& kHx) {
+  torch::Tensor layer1_output =
+      LinearBFloat16(critic.layer1, kInput.to(torch::kBFloat16)).relu();
+  torch::Tensor layer2_output =
+      LinearBFloat16(critic.layer2, layer1_output).relu();
+  std::vector<torch::Tensor> gru_weights = GruWeightsBFloat16(critic.rnn);
+
+  int64_t num_time_steps = kInput.size(0);
+  torch::Tensor hx = kHx.to(torch::kBFloat16);
+  std::vector<torch::Tensor> hidden_states;
+  hidden_states.reserve(num_time_steps);
+  for (int64_t t = 0; t < num_time_steps; t++) {
+    hx = std::get<1>(torch::gru(layer2_output.slice(0, t, t + 1), hx,
+                                gru_weights, true, 1, 0.0,
+                                critic.is_training(), false, false))
+             .tanh();
+    hidden_states.push_back(hx);
+  }
+
+  return LinearBFloat16(critic.output_layer, torch::cat(hidden_states, 0))
+      .to(torch::kFloat);
+}
+
+/* Whether every parameter of two networks of the same type is equal, without
+ * printing anything */
+static bool ParametersEqual(const torch::nn::Module& kFirst,
+                            const torch::nn::Module& kSecond) {
+  std::vector<torch::Tensor> first_parameters = kFirst.parameters();
+  std::vector<torch::Tensor> second_parameters = kSecond.parameters();
+  if (first_parameters.size() != second_parameters.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < first_parameters.size(); i++) {
+    if (!first_parameters[i].equal(second_parameters[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+MappoTrainer::MappoTrainer(PolicyNetwork& policy, CriticNetwork& critic,
+                           int num_epochs, int num_mini_batches,
+                           double kl_target)
+    : policy_(policy), critic_(critic),
+      policy_optimizer_(CreateOptimizer(policy)),
+      critic_optimizer_(CreateOptimizer(critic)), num_epochs_(num_epochs),
+      num_mini_batches_(num_mini_batches), kl_target_(kl_target),
+      num_optimizer_steps_(0), mode_(TrainingMode::kRelease),
+      precision_(TrainingPrecision::kFloat32) {}
+
+torch::Tensor MappoTrainer::Update(const RolloutStorage& rollout) {
+  policy_.train();
+  critic_.train();
+  torch::AutoGradMode enable_grad_mode(true);
+
+  /* Anomaly detection records a stack trace for every autograd node, so it
+   * is only enabled for debugging */
+  std::optional<torch::autograd::DetectAnomalyGuard> detect_anomaly;
+  if (mode_ == TrainingMode::kDebug) {
+    std::cout << "Updating hidden states" << std::endl;
+    detect_anomaly.emplace();
+  }
+
+  epoch_statistics_.clear();
+  std::vector<torch::Tensor> losses;
+  for (int epoch = 0; epoch < num_epochs_; epoch++) {
+    /* Every pass trains on each chunk of the D once, in a new order. */
+    std::vector<torch::Tensor> mini_batches =
+        torch::randperm(rollout.NumChunks(), torch::kLong)
+            .tensor_split(num_mini_batches_);
+
+    std::vector<torch::Tensor> epoch_results;
+    for (const torch::Tensor& kChunkIndices : mini_batches) {
+      epoch_results.push_back(
+          TrainMiniBatch(rollout.GetChunks(kChunkIndices)));
+    }
+
+    /* One read back of the statistics per pass */
+    torch::Tensor mean_results = torch::stack(epoch_results).mean(0);
+    losses.push_back(mean_results.slice(0, 0, 2));
+    EpochStatistics statistics{
+        mean_results[0].item<double>(), mean_results[1].item<double>(),
+        mean_results[2].item<double>(), mean_results[3].item<double>()};
+    epoch_statistics_.push_back(statistics);
+
+    std::cout << "Epoch " << epoch << ": KL " << statistics.approximate_kl
+              << ", clip fraction " << statistics.clip_fraction << std::endl;
+
+    /* Stop before the policy moves too far from the one that collected the
+     * rollout */
+    if (kl_target_ > 0 && statistics.approximate_kl > kl_target_) {
+      std::cout << "Stopping early, KL above " << kl_target_ << std::endl;
+      break;
+    }
+  }
+
+  torch::Tensor mean_losses = torch::stack(losses).mean(0);
+
+  std::cout << "Training of buffer done! " << std::endl;
+  std::cout << "Policy loss: " << mean_losses[0] << std::endl;
+  std::cout << "Critic loss: " << mean_losses[1] << std::endl;
+  std::cout << "==============================================" << std::endl;
+
+  return mean_losses;
+}
+
+torch::Tensor MappoTrainer::TrainMiniBatch(const RolloutChunk& kMiniBatch) {
+  /* Create the arrays fit update functions. */
+  int64_t num_chunks = kMiniBatch.states.size(0);
+  int64_t num_time_steps = kMiniBatch.states.size(1); /* Timesteps in batch */
+
+  torch::Tensor states = kMiniBatch.states; /* [C, T, states] */
+  torch::Tensor actions =
+      kMiniBatch.actions.permute({0, 2, 1}); /* [C, agents, T] */
+  torch::Tensor reward_to_go = kMiniBatch.reward_to_go.permute({0, 2, 1});
+  torch::Tensor gae = kMiniBatch.advantages.permute({0, 2, 1});
+
+  /* Assert sizes */
+  assert(reward_to_go.size(0) == num_chunks);
+  assert(reward_to_go.size(1) == amount_of_players_in_team);
+  assert(reward_to_go.size(2) == num_time_steps);
+
+  /* Critic input, [T, C, num_global_states], where the reserved robot id is
+   * set to -1 since the critic is shared by all agents. */
+  torch::Tensor global_states = states.transpose(0, 1).clone();
+  global_states.select(2, 0).fill_(-1);
+  torch::Tensor h0_critic =
+      kMiniBatch.critic_hidden_states.select(1, 0).unsqueeze(0);
+
+  /* Policy input, [T, C * agents, num_local_states], where every agent of
+   * every chunk is its own sequence in the batch. */
+  torch::Tensor local_states =
+      ComputeLocalStates(states.transpose(0, 1))
+          .reshape({num_time_steps, num_chunks * amount_of_players_in_team,
+                    num_local_states});
+  torch::Tensor h0_policy =
+      kMiniBatch.policy_hidden_states.select(1, 0).reshape(
+          {1, num_chunks * amount_of_players_in_team, hidden_size});
+
+  /* The behaviour policy and values recorded while acting, which are
+   * constants in the losses. No network is run again to get them. */
+  torch::Tensor old_log_probabilities =
+      kMiniBatch.log_probabilities.permute({0, 2, 1}); /* [C, agents, T] */
+  torch::Tensor old_predicts_c = kMiniBatch.values;  /* [C, T] */
+
+  /* Predictions of the current networks, in float32 from here on whatever
+   * precision the networks ran in. */
+  torch::Tensor pred_p;
+  torch::Tensor new_predicts_c;
+  {
+    CENTRALISEDAI_TIME_PHASE(Phase::kUpdateForward);
+    if (precision_ == TrainingPrecision::kBFloat16) {
+      pred_p = ForwardPolicyBFloat16(policy_, local_states, h0_policy);
+      new_predicts_c =
+          ForwardCriticBFloat16(critic_, global_states, h0_critic);
+    } else {
+      pred_p = std::get<0>(policy_.ForwardSequence(local_states, h0_policy));
+      new_predicts_c =
+          std::get<0>(critic_.ForwardSequence(global_states, h0_critic));
+    }
+  }
+  pred_p = torch::softmax(pred_p, -1);
+  new_predicts_c =
+      new_predicts_c.reshape({num_time_steps, num_chunks}).transpose(0, 1);
+
+  /* Check if pred_p contains zeros, which waits for the forward pass */
+  if (mode_ == TrainingMode::kDebug && pred_p.eq(0).any().item<bool>()) {
+    std::cerr << "Error: pred_p contains zero values after softmax!"
+              << std::endl;
+  }
+
+  /* Keep the log-probabilities, ratios and entropy finite in every mode */
+  pred_p = torch::clamp(pred_p, 1e-10, 1.0);
+
+  /* Predictions of all actions per agent, [C, agents, T, num_actions] */
+  torch::Tensor all_actions_probs =
+      pred_p
+          .reshape({num_time_steps, num_chunks, amount_of_players_in_team,
+                    num_actions})
+          .permute({1, 2, 0, 3});
+
+  /* Predictions of the performed actions, [C, agents, T] */
+  torch::Tensor new_policy_probabilities =
+      all_actions_probs.gather(3, actions.unsqueeze(3)).squeeze(3);
+
+  assert(all_actions_probs.requires_grad() == true);
+  assert(new_policy_probabilities.requires_grad() == true);
+  assert(new_predicts_c.requires_grad() == true);
+
+  /* The losses of the mini batch */
+  torch::Tensor approximate_kl;
+  torch::Tensor clip_fraction;
+  torch::Tensor policy_loss;
+  torch::Tensor critic_loss;
+  {
+    CENTRALISEDAI_TIME_PHASE(Phase::kUpdateLoss);
+
+    /* Compute policy entropy */
+    torch::Tensor policy_entropy =
+        ComputePolicyEntropy(all_actions_probs, entropy_coefficient);
+
+    /* Compute probability ratios */
+    torch::Tensor probability_ratios = ComputeProbabilityRatio(
+        new_policy_probabilities, old_log_probabilities.exp());
+
+    /* How far the policy has moved from the one that collected the chunks,
+     * with the approximation (ratio - 1) - log(ratio) of the KL divergence */
+    {
+      torch::NoGradGuard no_grad;
+      torch::Tensor log_ratios =
+          new_policy_probabilities.log() - old_log_probabilities;
+      approximate_kl =
+          ((probability_ratios - 1) - log_ratios).mean().reshape({1});
+      clip_fraction = ((probability_ratios - 1).abs() > clip_value)
+                          .to(torch::kFloat)
+                          .mean()
+                          .reshape({1});
+    }
+
+    /* Compute policy loss */
+    policy_loss =
+        -ComputePolicyLoss(gae, probability_ratios, clip_value, policy_entropy);
+
+    /* Compute critic loss */
+    critic_loss = ComputeCriticLoss(new_predicts_c, old_predicts_c,
+                                    reward_to_go, clip_value);
+  }
+
+  assert(policy_loss.requires_grad() && "policy_loss must require gradients");
+  assert(critic_loss.requires_grad() && "critic_loss must require gradients");
+
+  if (mode_ == TrainingMode::kDebug) {
+    std::cout << "Calculate losses and update networks" << std::endl;
+
+    if (policy_loss.isnan().any().item<bool>()) {
+      throw std::runtime_error("policy_loss contains NaNs");
+    }
+    if (critic_loss.isnan().any().item<bool>()) {
+      throw std::runtime_error("critic_loss contains NaNs");
+    }
+
+    CopyParameters(policy_, *previous_policy_);
+    CopyParameters(critic_, *previous_critic_);
+  }
+
+  /* Update the networks, with the moment estimates of earlier steps */
+  {
+    CENTRALISEDAI_TIME_PHASE(Phase::kUpdateBackward);
+    UpdateNets(policy_, critic_, policy_optimizer_, critic_optimizer_,
+               policy_loss, critic_loss);
+  }
+  num_optimizer_steps_++;
+
+  /* Every optimizer step should change both networks */
+  if (mode_ == TrainingMode::kDebug) {
+    if (ParametersEqual(*previous_policy_, policy_)) {
+      std::cerr << "Error: the optimizer step did not change the policy "
+                   "network!"
+                << std::endl;
+    }
+    if (ParametersEqual(*previous_critic_, critic_)) {
+      std::cerr << "Error: the optimizer step did not change the critic "
+                   "network!"
+                << std::endl;
+    }
+  }
+
+  return torch::cat({policy_loss.detach(), critic_loss.detach(),
+                     approximate_kl, clip_fraction});
+}
+
+void MappoTrainer::SaveCheckpoint() {
+  CENTRALISEDAI_TIME_PHASE(Phase::kSave);
+  SaveNetworks(policy_, critic_);
+
+  try {
+    torch::save(policy_optimizer_, "../models/policy_optimizer.pt");
+    torch::save(critic_optimizer_, "../models/critic_optimizer.pt");
+  } catch (const std::exception& kException) {
+    std::cerr << "Error saving optimizers: " << kException.what()
+              << std::endl;
+  }
+
+  try {
+    ExportPolicy(policy_, kExportedPolicyPath);
+  } catch (const std::exception& kException) {
+    std::cerr << "Error exporting policy: " << kException.what() << std::endl;
+  }
+}
+
+void MappoTrainer::LoadCheckpoint() {
+  LoadNetworks(policy_, critic_);
+
+  try {
+    torch::load(policy_optimizer_, "../models/policy_optimizer.pt");
+    torch::load(critic_optimizer_, "../models/critic_optimizer.pt");
+    std::cout << "Loading optimizers from ../models" << std::endl;
+  } catch (const std::exception& kException) {
+    std::cerr << "Error loading optimizers: " << kException.what()
+              << std::endl;
+
+    throw std::runtime_error("Error loading optimizers");
+  }
+}
+
+const std::vector<EpochStatistics>& MappoTrainer::GetEpochStatistics() const {
+  return epoch_statistics_;
+}
+
+void MappoTrainer::SetTrainingMode(TrainingMode mode) {
+  mode_ = mode;
+
+  if (mode_ == TrainingMode::kDebug && !previous_policy_) {
+    previous_policy_ = std::make_unique<PolicyNetwork>();
+    previous_critic_ = std::make_unique<CriticNetwork>();
+  }
+}
+
+void MappoTrainer::SetTrainingPrecision(TrainingPrecision precision) {
+  precision_ = precision;
+}
+
+PolicyNetwork& MappoTrainer::GetPolicy() { return policy_; }
+
+CriticNetwork& MappoTrainer::GetCritic() { return critic_; }
+
+int64_t MappoTrainer::NumOptimizerSteps() const {
+  return num_optimizer_steps_;
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
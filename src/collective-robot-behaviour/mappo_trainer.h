@@ -0,0 +1,279 @@
+/* mappo_trainer.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Trainer that owns the optimizers of the networks and updates
+ * the networks on collected rollouts.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_MAPPOTRAINER_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_MAPPOTRAINER_H_
+
+#include "../../src/common_types.h"
+#include "memory"
+#include "network.h"
+#include "rollout_storage.h"
+#include "stdint.h"
+#include "torch/torch.h"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief How much checking MappoTrainer does while training.
+ */
+enum class TrainingMode {
+  /*!
+   * @brief No diagnostics in the update, so nothing waits on the values of
+   * tensors except the per-pass statistics.
+   */
+  kRelease,
+
+  /*!
+   * @brief Runs the backward passes with anomaly detection, prints every
+   * step, checks the predictions for zero probabilities, stops with an
+   * exception on NaN losses and checks that every step changed the
+   * parameters of both networks.
+   */
+  kDebug
+};
+
+/*!
+ * @brief Precision of the network forward and backward passes in
+ * MappoTrainer.
+ */
+enum class TrainingPrecision {
+  /*!
+   * @brief Everything in float32.
+   */
+  kFloat32,
+
+  /*!
+   * @brief The Linear layers and the GRU run in bfloat16 on bfloat16 copies
+   * of the float32 weights, which the gradients flow back into. The
+   * softmax, the losses and their reductions, the gradients and the Adam
+   * state stay in float32. bfloat16 has the exponent range of float32, so no
+   * loss scaling is needed. Only faster on CPUs with native bfloat16 matrix
+   * instructions, such as AVX-512 BF16 or AMX.
+   */
+  kBFloat16
+};
+
+/*!
+ * @brief Statistics of one pass over a rollout, averaged over its mini
+ * batches.
+ */
+struct EpochStatistics {
+  /*!
+   * @brief Policy loss.
+   */
+  double policy_loss;
+
+  /*!
+   * @brief Critic loss.
+   */
+  double critic_loss;
+
+  /*!
+   * @brief Approximate KL divergence of the trained policy from the policy
+   * that collected the rollout, before each optimizer step.
+   */
+  double approximate_kl;
+
+  /*!
+   * @brief Fraction of the probability ratios outside [1 - clip_value,
+   * 1 + clip_value].
+   */
+  double clip_fraction;
+};
+
+/*!
+ * @brief Class that trains the policy and critic network with MAPPO.
+ *
+ * The Adam optimizers of both networks live as long as the trainer, so their
+ * moment estimates carry over from one update to the next, and they are
+ * checkpointed together with the networks.
+ *
+ * Each update takes up to num_epochs passes over the rollout. Every pass
+ * shuffles all chunks of the rollout and splits them into num_mini_batches
+ * mini batches, with one optimizer step per mini batch, so each chunk is
+ * trained on once per pass. Once the mean KL divergence of a pass exceeds
+ * target_kl, the remaining passes are skipped.
+ *
+ * The networks keep their float32 weights in either TrainingPrecision.
+ *
+ * @note Not copyable, not moveable. The networks must outlive the trainer.
+ */
+class MappoTrainer
+{
+ public:
+  /*!
+   * @brief Constructor that creates the optimizers of the networks.
+   *
+   * @param[in] policy Policy network that is trained.
+   *
+   * @param[in] critic Critic network that is trained.
+   *
+   * @param[in] num_epochs Number of passes over each rollout.
+   *
+   * @param[in] num_mini_batches Number of mini batches, and optimizer steps,
+   * per pass.
+   *
+   * @param[in] kl_target Mean approximate KL divergence of a pass above
+   * which the update stops. Zero or less never stops early.
+   */
+  MappoTrainer(PolicyNetwork& policy, CriticNetwork& critic,
+               int num_epochs = ppo_epochs,
+               int num_mini_batches = ppo_mini_batches,
+               double kl_target = target_kl);
+
+  MappoTrainer(const MappoTrainer&) = delete;
+  MappoTrainer& operator=(const MappoTrainer&) = delete;
+
+  /*!
+   * @brief Trains the networks on a rollout.
+   *
+   * @pre The rollout has at least num_mini_batches chunks.
+   *
+   * @param[in] rollout The rollout collected with the networks, or with
+   * earlier versions of them.
+   *
+   * @returns The losses averaged over all mini batches that were trained on,
+   * [policy_loss, critic_loss].
+   *
+   * @throws std::runtime_error in kDebug mode if a loss is NaN.
+   */
+  torch::Tensor Update(const RolloutStorage& rollout);
+
+  /*!
+   * @brief Returns the statistics of every pass of the last update, which
+   * has fewer than num_epochs entries if the update stopped early.
+   */
+  const std::vector<EpochStatistics>& GetEpochStatistics() const;
+
+  /*!
+   * @brief Sets how much checking is done while training, kRelease by
+   * default.
+   */
+  void SetTrainingMode(TrainingMode mode);
+
+  /*!
+   * @brief Sets the precision of the network passes while training,
+   * kFloat32 by default.
+   */
+  void SetTrainingPrecision(TrainingPrecision precision);
+
+  /*!
+   * @brief Saves the networks with SaveNetworks, and the optimizers next to
+   * them in the models folder, and exports the policy for inference to
+   * kExportedPolicyPath.
+   */
+  void SaveCheckpoint();
+
+  /*!
+   * @brief Loads the networks with LoadNetworks, and the optimizers from the
+   * models folder.
+   *
+   * @throws std::runtime_error if a file could not be loaded.
+   */
+  void LoadCheckpoint();
+
+  /*!
+   * @brief Returns the trained policy network.
+   */
+  PolicyNetwork& GetPolicy();
+
+  /*!
+   * @brief Returns the trained critic network.
+   */
+  CriticNetwork& GetCritic();
+
+  /*!
+   * @brief Returns the number of optimizer steps taken since construction.
+   */
+  int64_t NumOptimizerSteps() const;
+
+ protected:
+  /*!
+   * @brief Computes the losses on one mini batch and takes one optimizer
+   * step.
+   *
+   * @returns The losses and statistics before the step, [policy_loss,
+   * critic_loss, approximate_kl, clip_fraction].
+   */
+  torch::Tensor TrainMiniBatch(const RolloutChunk& kMiniBatch);
+
+  /*!
+   * @brief Policy network that is trained.
+   */
+  PolicyNetwork& policy_;
+
+  /*!
+   * @brief Critic network that is trained.
+   */
+  CriticNetwork& critic_;
+
+  /*!
+   * @brief Optimizer of the policy network parameters.
+   */
+  torch::optim::Adam policy_optimizer_;
+
+  /*!
+   * @brief Optimizer of the critic network parameters.
+   */
+  torch::optim::Adam critic_optimizer_;
+
+  /*!
+   * @brief Number of passes over each rollout.
+   */
+  int num_epochs_;
+
+  /*!
+   * @brief Number of mini batches per pass.
+   */
+  int num_mini_batches_;
+
+  /*!
+   * @brief Mean approximate KL divergence of a pass above which the update
+   * stops.
+   */
+  double kl_target_;
+
+  /*!
+   * @brief Number of optimizer steps taken since construction.
+   */
+  int64_t num_optimizer_steps_;
+
+  /*!
+   * @brief Statistics of every pass of the last update.
+   */
+  std::vector<EpochStatistics> epoch_statistics_;
+
+  /*!
+   * @brief How much checking is done while training.
+   */
+  TrainingMode mode_;
+
+  /*!
+   * @brief Precision of the network passes while training.
+   */
+  TrainingPrecision precision_;
+
+  /*!
+   * @brief Copies of the networks before the latest step, only created in
+   * kDebug mode.
+   */
+  std::unique_ptr<PolicyNetwork> previous_policy_;
+  std::unique_ptr<CriticNetwork> previous_critic_;
+};
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_MAPPOTRAINER_H_ */
@@ -10,8 +10,10 @@
 
 #include "network.h"
 #include "../../src/common_types.h"
+#include "chrono"
 #include "communication.h"
 #include "filesystem"
+#include "functional"
 #include "mappo.h"
 #include "torch/script.h"
 #include "torch/torch.h"
@@ -21,24 +23,6 @@ namespace centralised_ai
 namespace collective_robot_behaviour
 {
 
-DataBuffer::DataBuffer()
-    : A(torch::zeros({1, amount_of_players_in_team})),
-      R(torch::zeros({1, amount_of_players_in_team})) {}
-
-Trajectory::Trajectory()
-    : state(torch::zeros({1, 1, num_global_states})),
-      actions_prob(torch::zeros({num_actions})),
-      rewards(torch::zeros(amount_of_players_in_team)),
-      actions(torch::zeros({amount_of_players_in_team})),
-      new_state(torch::zeros({1, 1, num_global_states})) {}
-
-HiddenStates::HiddenStates()
-    : ht_p(torch::zeros(
-          {1, 1, hidden_size})), /* Hidden state tensor initialized to zeros */
-      ct_p(torch::zeros(
-          {1, 1, hidden_size})) /* Cell state tensor initialized to zeros */
-{}
-
 PolicyNetwork::PolicyNetwork()
     : kNumLayers(1), kOutputSize(num_actions),
       layer1(torch::nn::Linear(num_local_states, hidden_size)),
@@ -83,6 +67,23 @@ PolicyNetwork::Forward(torch::Tensor input, torch::Tensor hx) {
   return std::make_tuple(output, gru_hidden_states);
 }
 
+std::tuple<torch::Tensor, torch::Tensor>
+PolicyNetwork::ForwardSequence(torch::Tensor input, torch::Tensor hx) {
+  torch::Tensor layer1_output = layer1->forward(input).tanh();
+  torch::Tensor layer2_output = layer2->forward(layer1_output).tanh();
+
+  /* The GRU output of each time step equals the hidden state after that time
+   * step, which is what Forward feeds into the output layer. */
+  std::tuple<torch::Tensor, torch::Tensor> gru_output =
+      rnn->forward(layer2_output, hx);
+  torch::Tensor gru_out = std::get<0>(gru_output);
+  torch::Tensor gru_hidden_states = std::get<1>(gru_output);
+
+  torch::Tensor output = output_layer(gru_out);
+
+  return std::make_tuple(output, gru_hidden_states);
+}
+
 CriticNetwork::CriticNetwork()
     : layer1(torch::nn::Linear(num_global_states, hidden_size)),
       layer2(torch::nn::Linear(hidden_size, hidden_size)),
@@ -133,6 +134,29 @@ CriticNetwork::Forward(torch::Tensor input, torch::Tensor hx) {
   return std::make_tuple(output, gru_hidden_states);
 }
 
+std::tuple<torch::Tensor, torch::Tensor>
+CriticNetwork::ForwardSequence(torch::Tensor input, torch::Tensor hx) {
+  /* The input layers do not depend on the hidden state, so they are computed
+   * for all time steps at once. */
+  torch::Tensor layer1_output = layer1->forward(input).relu();
+  torch::Tensor layer2_output = layer2->forward(layer1_output).relu();
+
+  int64_t num_time_steps = input.size(0);
+  std::vector<torch::Tensor> hidden_states;
+  hidden_states.reserve(num_time_steps);
+
+  for (int64_t t = 0; t < num_time_steps; t++) {
+    std::tuple<torch::Tensor, torch::Tensor> gru_output =
+        rnn->forward(layer2_output.slice(0, t, t + 1), hx);
+    hx = std::get<1>(gru_output).tanh();
+    hidden_states.push_back(hx);
+  }
+
+  torch::Tensor output = output_layer->forward(torch::cat(hidden_states, 0));
+
+  return std::make_tuple(output, hx);
+}
+
 PolicyNetwork CreatePolicy() {
   PolicyNetwork policy;
   policy.rnn->reset_parameters();
@@ -197,87 +221,84 @@ void LoadNetworks(PolicyNetwork& policy, CriticNetwork& critic) {
   }
 }
 
-void SaveOldNetworks(PolicyNetwork& policy, CriticNetwork& critic) {
+void CopyParameters(const torch::nn::Module& source,
+                    torch::nn::Module& target) {
+  torch::NoGradGuard no_grad;
 
-  try {
-    std::string model_path = "../models/old_agents/agent_network0.pt";
-    torch::serialize::OutputArchive output_archive;
+  CopyParameters(source.parameters(), target);
 
-    policy.save(output_archive);
-    output_archive.save_to(model_path);
-  } catch (const std::exception& kException) {
-    std::cerr << "Error saving model for agent " << 0 << ": " << kException.what()
-              << std::endl;
+  std::vector<torch::Tensor> source_buffers = source.buffers();
+  std::vector<torch::Tensor> target_buffers = target.buffers();
+  for (size_t i = 0; i < target_buffers.size(); i++) {
+    target_buffers[i].copy_(source_buffers[i]);
   }
+}
 
-  try {
-    std::string model_path = "../models/old_agents/critic_network.pt";
-    torch::serialize::OutputArchive output_archive;
+void CopyParameters(const std::vector<torch::Tensor>& source,
+                    torch::nn::Module& target) {
+  torch::NoGradGuard no_grad;
 
-    critic.save(output_archive);
-    output_archive.save_to(model_path);
-  } catch (const std::exception& kException) {
-    std::cerr << "Error saving model for critic network!" << std::endl;
+  std::vector<torch::Tensor> target_parameters = target.parameters();
+  for (size_t i = 0; i < target_parameters.size(); i++) {
+    target_parameters[i].copy_(source[i]);
   }
 }
 
-void LoadOldNetworks(PolicyNetwork& policy, CriticNetwork& critic) {
+Checkpointer::Checkpointer(std::chrono::steady_clock::duration min_interval)
+    : min_interval_(min_interval), has_saved_(false) {}
 
-  /* Load the policy network */
-  try {
-    std::string policy_path =
-        "../models/old_agents/agent_network" + std::to_string(0) + ".pt";
-    torch::serialize::InputArchive input_archive;
-    input_archive.load_from(policy_path);
-
-    policy.load(input_archive);
+bool Checkpointer::SaveIfDue(PolicyNetwork& policy, CriticNetwork& critic) {
+  return SaveIfDue([&]() { SaveNetworks(policy, critic); });
+}
 
-    std::cout << "Loading policy network from " << policy_path << std::endl;
-  } catch (const std::exception& kException) {
-    std::cerr << "Error loading model for policy network: " << kException.what()
-              << std::endl;
+bool Checkpointer::SaveIfDue(const std::function<void()>& save) {
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  if (has_saved_ && now - last_save_ < min_interval_) {
+    return false;
   }
 
-  /* Load the critic network */
-  try {
-    std::string critic_path = "../models/old_agents/critic_network.pt";
-    torch::serialize::InputArchive critic_archive;
-    critic_archive.load_from(critic_path);
+  save();
+  last_save_ = now;
+  has_saved_ = true;
 
-    critic.load(critic_archive);
-    std::cout << "Loading critic network from " << critic_path << std::endl;
-  } catch (const std::exception& kException) {
-    std::cerr << "Error loading model for critic network: " << kException.what()
-              << std::endl;
-  }
+  return true;
 }
 
-void UpdateNets(PolicyNetwork& policy, CriticNetwork& critic,
-                torch::Tensor pol_loss, torch::Tensor cri_loss) {
-
+torch::optim::Adam CreateOptimizer(torch::nn::Module& network) {
   /* Set up Adam options*/
   torch::optim::AdamOptions adam_options;
-  adam_options.lr(1e-4);
+  adam_options.lr(learning_rate);
   adam_options.eps(1e-5);
   adam_options.weight_decay(0);
 
-  torch::optim::Adam opts({policy.parameters()}, adam_options);
+  return torch::optim::Adam(network.parameters(), adam_options);
+}
+
+void UpdateNets(PolicyNetwork& policy, CriticNetwork& critic,
+                torch::Tensor pol_loss, torch::Tensor cri_loss) {
+  /* Optimizers that only live for this update */
+  torch::optim::Adam opts = CreateOptimizer(policy);
+  torch::optim::Adam critnet = CreateOptimizer(critic);
 
-  /* Update critic network */
-  torch::optim::Adam critnet({critic.parameters()}, adam_options);
+  UpdateNets(policy, critic, opts, critnet, pol_loss, cri_loss);
+}
 
+void UpdateNets(PolicyNetwork& policy, CriticNetwork& critic,
+                torch::optim::Optimizer& policy_optimizer,
+                torch::optim::Optimizer& critic_optimizer,
+                torch::Tensor pol_loss, torch::Tensor cri_loss) {
   /* Zero the gradients before the backward pass */
-  opts.zero_grad();
-  critnet.zero_grad();
+  policy_optimizer.zero_grad();
+  critic_optimizer.zero_grad();
 
   torch::Tensor loss = pol_loss + cri_loss;
   loss.backward();
 
-  torch::nn::utils::clip_grad_norm_(policy.parameters(), 0.2);
-  torch::nn::utils::clip_grad_norm_(critic.parameters(), 0.2);
+  torch::nn::utils::clip_grad_norm_(policy.parameters(), max_gradient_norm);
+  torch::nn::utils::clip_grad_norm_(critic.parameters(), max_gradient_norm);
 
-  opts.step();
-  critnet.step();
+  policy_optimizer.step();
+  critic_optimizer.step();
 }
 
 } /* namespace collective_robot_behaviour */
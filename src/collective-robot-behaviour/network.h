@@ -12,82 +12,19 @@
 #define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_NETWORK_H_
 
 #include "../../src/common_types.h"
+#include "chrono"
 #include "communication.h"
 #include "filesystem"
+#include "functional"
 #include "torch/script.h"
 #include "torch/torch.h"
+#include "vector"
 
 namespace centralised_ai
 {
 namespace collective_robot_behaviour
 {
 
-/*!
- * @brief Struct is the hidden states used for the networks
- *
- * Struct contains the hidden state (ht_p) and the cell state (ct_p)
- *
- * Initalised, hidden state and cell state is 3 dim of zeroes in range of the
- * hidden_size hidden state array: (2 if bidirectional=True otherwise 1, batch
- * size , if proj size > 0 otherwise hidden size ) cell state array: (2 if
- * bidirectional=True otherwise 1 * num layers, batch size , hidden size)
- *
- * @note PyTorch LSTM instructions from
- * https://pytorch.org/docs/stable/generated/torch.nn.LSTM.html
- */
-struct HiddenStates {
-  torch::Tensor ht_p;
-  torch::Tensor ct_p;
-
-  HiddenStates();
-};
-
-/*!
- * @brief Struct representing a trajectory array used during training.
- *
- * This struct contains state, action probabilities, rewards, new state,
- * policy hidden states (HiddenStates struct), and critic hidden states
- * (HiddenStates struct).
- *
- * Initalised, state,actions and new_state is zeroes. Rewards is empty float
- *
- * @note The concept of a trajectory array is detailed in:
- * "The Surprising Effectiveness of PPO in Cooperative Multi-Agent Games" -
- * https://arxiv.org/pdf/2103.01955
- */
-struct Trajectory {
-  torch::Tensor state;
-  torch::Tensor actions_prob;
-  torch::Tensor actions;
-  torch::Tensor rewards;
-  torch::Tensor new_state;
-  std::vector<HiddenStates> hidden_states_policy;
-  HiddenStates hidden_states_critic;
-  torch::Tensor critic_value;
-
-  Trajectory();
-};
-
-/*!
- * @brief DataBuffer Struct representing a data buffer for storing data in
- * chunks during training.
- *
- * This struct organizes stored trajectories in chunks.
- * It contains a vector of Trajectory struct, A (GAE) and R (Compute
- * reward-to-go) Additional tensors (A and R) represent accumulated advantages
- * and rewards used in training updates.
- *
- * @note Referred to as "D" in the paper, "The Surprising Effectiveness of PPO
- * in Cooperative Multi-Agent Games" - https://arxiv.org/pdf/2103.01955
- */
-struct DataBuffer {
-  std::vector<Trajectory> t;
-  torch::Tensor A;
-  torch::Tensor R;
-
-  DataBuffer();
-};
-
 /*!
  * @brief Struct of the policy network based on the paper "The Surprising
  * Effectiveness of PPO in Cooperative Multi-Agent Games" -
@@ -119,6 +56,25 @@ struct PolicyNetwork : torch::nn::Module {
    */
   std::tuple<torch::Tensor, torch::Tensor> Forward(torch::Tensor input,
                                                    torch::Tensor hx);
+
+  /*!
+   * @brief Forward function over a whole sequence of time steps for a batch of
+   * agents, using a single GRU call.
+   *
+   * @details Gives the same outputs as calling Forward once per time step and
+   * feeding the returned hidden state into the next call.
+   *
+   * @param[in] input states with the shape [num_time_steps, batch_size,
+   * num_local_states].
+   * @param[in] hx hidden state before the first time step, with the shape
+   * [1, batch_size, hidden_size].
+   *
+   * @returns A tuple with the values (Predicted actions for every time step
+   * with the shape [num_time_steps, batch_size, num_actions], hx after the
+   * last time step).
+   */
+  std::tuple<torch::Tensor, torch::Tensor> ForwardSequence(torch::Tensor input,
+                                                           torch::Tensor hx);
 };
 
 /*!
@@ -144,6 +100,27 @@ struct CriticNetwork : torch::nn::Module {
   CriticNetwork();
   std::tuple<torch::Tensor, torch::Tensor> Forward(torch::Tensor input,
                                                    torch::Tensor hx);
+
+  /*!
+   * @brief Forward function over a whole sequence of time steps for a batch of
+   * chunks.
+   *
+   * @details Gives the same outputs as calling Forward once per time step and
+   * feeding the returned hidden state into the next call. Since Forward
+   * squashes the returned hidden state with tanh, the recurrence is stepped
+   * once per time step, but every step is batched over all chunks.
+   *
+   * @param[in] input states with the shape [num_time_steps, batch_size,
+   * num_global_states].
+   * @param[in] hx hidden state before the first time step, with the shape
+   * [1, batch_size, hidden_size].
+   *
+   * @returns A tuple with the values (Predicted values for every time step
+   * with the shape [num_time_steps, batch_size, 1], hx after the last time
+   * step).
+   */
+  std::tuple<torch::Tensor, torch::Tensor> ForwardSequence(torch::Tensor input,
+                                                           torch::Tensor hx);
 };
 
 /*!
@@ -173,25 +150,79 @@ void SaveNetworks(PolicyNetwork& policy, CriticNetwork& critic);
 void LoadNetworks(PolicyNetwork& policy, CriticNetwork& critic);
 
 /*!
- * @brief Load old network models via the /models/old_agents folder.
+ * @brief Copy the parameters and buffers of a network into another network of
+ * the same type, without tracking gradients.
  *
- * @param[in] policy A reference to the PolicyNetwork
- * @param[in] critic A reference to the CriticNetwork
+ * @param[in] source The network to copy from.
+ * @param[out] target The network to copy into.
  */
-void LoadOldNetworks(PolicyNetwork& policy, CriticNetwork& critic);
+void CopyParameters(const torch::nn::Module& source,
+                    torch::nn::Module& target);
 
 /*!
- * @brief Save the old policy and the critic network in models/old_agents
- * folder.
+ * @brief Copy a list of tensors into the parameters of a network, without
+ * tracking gradients.
  *
- * This function serializes the parameters of the given agents' policy networks
- * and the critic network into a file. This allows for the preservation of the
- * trained models' weights, enabling later recovery or continuation of training.
+ * @param[in] source The tensors to copy from, in the order of
+ * target.parameters().
+ * @param[out] target The network to copy into.
+ */
+void CopyParameters(const std::vector<torch::Tensor>& source,
+                    torch::nn::Module& target);
+
+/*!
+ * @brief Saves the networks with SaveNetworks at most once per interval.
  *
- * @param[in] policy A reference to the old policy network instance.
- * @param[in] critic A reference to the old critic network instance.
+ * Writing the models to disk is kept out of the update itself, and the
+ * training loop asks for a checkpoint after every update instead.
  */
-void SaveOldNetworks(PolicyNetwork& policy, CriticNetwork& critic);
+class Checkpointer
+{
+ public:
+  /*!
+   * @brief Constructor.
+   *
+   * @param[in] min_interval The minimum time between two saves.
+   */
+  explicit Checkpointer(std::chrono::steady_clock::duration min_interval);
+
+  /*!
+   * @brief Save the networks if nothing has been saved yet or if min_interval
+   * has passed since the last save.
+   *
+   * @param[in] policy A reference to the policy network instance.
+   * @param[in] critic A reference to the critic network instance.
+   *
+   * @returns True if the networks were saved.
+   */
+  bool SaveIfDue(PolicyNetwork& policy, CriticNetwork& critic);
+
+  /*!
+   * @brief Call save if nothing has been saved yet or if min_interval has
+   * passed since the last save.
+   *
+   * @param[in] save Function that writes the checkpoint.
+   *
+   * @returns True if save was called.
+   */
+  bool SaveIfDue(const std::function<void()>& save);
+
+ protected:
+  /*!
+   * @brief The minimum time between two saves.
+   */
+  std::chrono::steady_clock::duration min_interval_;
+
+  /*!
+   * @brief The time of the last save.
+   */
+  std::chrono::steady_clock::time_point last_save_;
+
+  /*!
+   * @brief True once the networks have been saved.
+   */
+  bool has_saved_;
+};
 
 /*!
  * @brief Update all network weights from loss functions
@@ -204,6 +235,29 @@ void SaveOldNetworks(PolicyNetwork& policy, CriticNetwork& critic);
 void UpdateNets(PolicyNetwork& policy, CriticNetwork& critic,
                 torch::Tensor policy_loss, torch::Tensor critic_loss);
 
+/*!
+ * @brief Update all network weights from loss functions with optimizers that
+ * are kept between updates, so their moment estimates carry over.
+ *
+ * @param[in] policy A reference to the policy network.
+ * @param[in] critic A reference to the critic network.
+ * @param[in] policy_optimizer The optimizer of the policy network parameters.
+ * @param[in] critic_optimizer The optimizer of the critic network parameters.
+ * @param[in] policy_loss A tensor value representing the policy loss.
+ * @param[in] critic_loss A tensor value representing the critic loss.
+ */
+void UpdateNets(PolicyNetwork& policy, CriticNetwork& critic,
+                torch::optim::Optimizer& policy_optimizer,
+                torch::optim::Optimizer& critic_optimizer,
+                torch::Tensor policy_loss, torch::Tensor critic_loss);
+
+/*!
+ * @brief Create the Adam optimizer used to train a network.
+ *
+ * @param[in] network The network whose parameters are optimized.
+ */
+torch::optim::Adam CreateOptimizer(torch::nn::Module& network);
+
 } /* namespace collective_robot_behaviour */
 } /* namespace centralised_ai */
 
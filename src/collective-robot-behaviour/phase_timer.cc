@@ -0,0 +1,253 @@
+/* phase_timer.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Scoped timers for the phases of collection and training, which
+ * record into per-thread latency histograms, and the per-epoch percentiles of
+ * them.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "phase_timer.h"
+#include "algorithm"
+#include "array"
+#include "atomic"
+#include "bit"
+#include "chrono"
+#include "cmath"
+#include "filesystem"
+#include "fstream"
+#include "iostream"
+#include "memory"
+#include "mutex"
+#include "stdint.h"
+#include "string"
+#include "system_error"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Buckets per power of two are 2^kSubBucketBits, and durations from
+ * 2^kMaxBits ns share the last bucket */
+static const int kSubBucketBits = 5;
+static const int kMaxBits = 36;
+
+static_assert(LatencyHistogram::kNumBuckets ==
+                  ((kMaxBits - kSubBucketBits + 1) << kSubBucketBits),
+              "kNumBuckets does not cover durations up to 2^kMaxBits ns");
+
+/* The histograms of one thread, one per phase */
+using ThreadHistograms = std::array<LatencyHistogram, kNumPhases>;
+
+/* The histograms of every thread that has recorded, and the merged counts of
+ * the previous CollectPhaseStatistics, guarded by the mutex. They are never
+ * destroyed, since threads may still record while the program exits. */
+struct PhaseRegistry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadHistograms>> threads;
+  std::vector<std::vector<uint64_t>> previous_counts;
+};
+
+static PhaseRegistry& GetRegistry() {
+  static PhaseRegistry* registry = new PhaseRegistry();
+  return *registry;
+}
+
+/* The histograms of the calling thread, created on its first sample */
+static thread_local ThreadHistograms* thread_histograms = nullptr;
+
+const char* GetPhaseName(Phase phase) {
+  switch (phase) {
+  case Phase::kReceive:
+    return "receive";
+  case Phase::kReferee:
+    return "referee";
+  case Phase::kState:
+    return "state";
+  case Phase::kCriticForward:
+    return "critic_forward";
+  case Phase::kPolicyForward:
+    return "policy_forward";
+  case Phase::kSendActions:
+    return "send_actions";
+  case Phase::kRewards:
+    return "rewards";
+  case Phase::kUpdateForward:
+    return "update_forward";
+  case Phase::kUpdateLoss:
+    return "update_loss";
+  case Phase::kUpdateBackward:
+    return "update_backward";
+  case Phase::kSave:
+    return "save";
+  default:
+    return "unknown";
+  }
+}
+
+void LatencyHistogram::Record(uint64_t nanoseconds) {
+  std::atomic<uint64_t>& count = counts_[ComputeBucket(nanoseconds)];
+
+  /* Only this thread writes, so no read-modify-write is needed */
+  count.store(count.load(std::memory_order_relaxed) + 1,
+              std::memory_order_relaxed);
+}
+
+void LatencyHistogram::AddCountsTo(std::vector<uint64_t>& counts) const {
+  for (int i = 0; i < kNumBuckets; i++) {
+    counts[i] += counts_[i].load(std::memory_order_relaxed);
+  }
+}
+
+int LatencyHistogram::ComputeBucket(uint64_t nanoseconds) {
+  uint64_t value =
+      std::min<uint64_t>(nanoseconds, (uint64_t{1} << kMaxBits) - 1);
+  if (value < (uint64_t{2} << kSubBucketBits)) {
+    return static_cast<int>(value);
+  }
+
+  /* The top kSubBucketBits + 1 bits of the value, and the number of bits
+   * below them */
+  int shift = std::bit_width(value) - 1 - kSubBucketBits;
+  return static_cast<int>((static_cast<uint64_t>(shift) << kSubBucketBits) +
+                          (value >> shift));
+}
+
+uint64_t LatencyHistogram::ComputeBucketUpperBound(int bucket) {
+  if (bucket < (2 << kSubBucketBits)) {
+    return static_cast<uint64_t>(bucket);
+  }
+
+  int shift = (bucket >> kSubBucketBits) - 1;
+  uint64_t top_bits =
+      static_cast<uint64_t>(bucket - (shift << kSubBucketBits));
+  return ((top_bits + 1) << shift) - 1;
+}
+
+PhaseTimer::PhaseTimer(Phase phase)
+    : phase_(phase), start_(std::chrono::steady_clock::now()) {}
+
+PhaseTimer::~PhaseTimer() {
+  std::chrono::nanoseconds elapsed =
+      std::chrono::steady_clock::now() - start_;
+  RecordPhaseTime(phase_, static_cast<uint64_t>(elapsed.count()));
+}
+
+void RecordPhaseTime(Phase phase, uint64_t nanoseconds) {
+  if (thread_histograms == nullptr) {
+    PhaseRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.threads.push_back(std::make_unique<ThreadHistograms>());
+    thread_histograms = registry.threads.back().get();
+  }
+
+  (*thread_histograms)[static_cast<int>(phase)].Record(nanoseconds);
+}
+
+/* The smallest bucket upper bound below which a fraction of the samples lie,
+ * in microseconds */
+static double ComputePercentile(const std::vector<uint64_t>& kCounts,
+                                uint64_t total, double fraction) {
+  uint64_t rank = std::max<uint64_t>(
+      1, static_cast<uint64_t>(
+             std::ceil(fraction * static_cast<double>(total))));
+  uint64_t cumulative = 0;
+  for (int i = 0; i < LatencyHistogram::kNumBuckets; i++) {
+    cumulative += kCounts[i];
+    if (cumulative >= rank) {
+      return static_cast<double>(
+                 LatencyHistogram::ComputeBucketUpperBound(i)) /
+             1000.0;
+    }
+  }
+
+  return 0.0;
+}
+
+std::vector<PhaseStatistics> CollectPhaseStatistics() {
+  PhaseRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  if (registry.previous_counts.empty()) {
+    registry.previous_counts.assign(
+        kNumPhases, std::vector<uint64_t>(LatencyHistogram::kNumBuckets, 0));
+  }
+
+  std::vector<PhaseStatistics> statistics;
+  for (int phase = 0; phase < kNumPhases; phase++) {
+    std::vector<uint64_t> counts(LatencyHistogram::kNumBuckets, 0);
+    for (const std::unique_ptr<ThreadHistograms>& kThread : registry.threads) {
+      (*kThread)[phase].AddCountsTo(counts);
+    }
+
+    /* Only the samples since the previous call */
+    std::vector<uint64_t> interval_counts(counts);
+    uint64_t total = 0;
+    int last_bucket = 0;
+    for (int i = 0; i < LatencyHistogram::kNumBuckets; i++) {
+      interval_counts[i] -= registry.previous_counts[phase][i];
+      total += interval_counts[i];
+      if (interval_counts[i] > 0) {
+        last_bucket = i;
+      }
+    }
+    registry.previous_counts[phase] = counts;
+
+    PhaseStatistics phase_statistics{static_cast<Phase>(phase), total, 0.0,
+                                     0.0, 0.0};
+    if (total > 0) {
+      phase_statistics.p50_us =
+          ComputePercentile(interval_counts, total, 0.50);
+      phase_statistics.p99_us =
+          ComputePercentile(interval_counts, total, 0.99);
+      phase_statistics.max_us = static_cast<double>(
+          LatencyHistogram::ComputeBucketUpperBound(last_bucket)) / 1000.0;
+    }
+    statistics.push_back(phase_statistics);
+  }
+
+  return statistics;
+}
+
+void SavePhaseStatisticsToFile(const std::vector<PhaseStatistics>& kStatistics,
+                               int32_t epoch, const std::string& kFileName) {
+  /* The folder may not exist on the first epoch */
+  std::filesystem::path parent = std::filesystem::path(kFileName).parent_path();
+  std::error_code error;
+  if (!parent.empty()) {
+    std::filesystem::create_directories(parent, error);
+  }
+
+  bool is_new_file = !std::filesystem::exists(kFileName, error) ||
+                     std::filesystem::file_size(kFileName, error) == 0;
+  std::ofstream file(kFileName, std::ios::app);
+
+  if (!file.is_open()) {
+    std::cerr << "Could not open file: " << kFileName << std::endl;
+    return;
+  }
+
+  if (is_new_file) {
+    file << "epoch,phase,count,p50_us,p99_us,max_us" << std::endl;
+  }
+
+  for (const PhaseStatistics& kPhase : kStatistics) {
+    if (kPhase.count == 0) {
+      continue;
+    }
+
+    file << epoch << "," << GetPhaseName(kPhase.phase) << "," << kPhase.count
+         << "," << kPhase.p50_us << "," << kPhase.p99_us << ","
+         << kPhase.max_us << std::endl;
+  }
+
+  file.close();
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,261 @@
+/* phase_timer.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Scoped timers for the phases of collection and training, which
+ * record into per-thread latency histograms, and the per-epoch percentiles of
+ * them.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_PHASETIMER_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_PHASETIMER_H_
+
+#include "array"
+#include "atomic"
+#include "chrono"
+#include "stdint.h"
+#include "string"
+#include "vector"
+
+/*!
+ * @brief Times the rest of the enclosing scope as one sample of a Phase.
+ *
+ * Expands to nothing if CENTRALISEDAI_DISABLE_PHASE_TIMING is defined, which
+ * the PHASE_TIMING CMake option controls.
+ */
+#ifdef CENTRALISEDAI_DISABLE_PHASE_TIMING
+#define CENTRALISEDAI_TIME_PHASE(phase) static_cast<void>(0)
+#else
+#define CENTRALISEDAI_TIME_PHASE_CONCAT(a, b) a##b
+#define CENTRALISEDAI_TIME_PHASE_NAME(line) \
+  CENTRALISEDAI_TIME_PHASE_CONCAT(phase_timer_, line)
+#define CENTRALISEDAI_TIME_PHASE(phase)                  \
+  ::centralised_ai::collective_robot_behaviour::PhaseTimer \
+  CENTRALISEDAI_TIME_PHASE_NAME(__LINE__)(phase)
+#endif
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief The timed phases of a time step of collection and of a mini batch of
+ * training.
+ */
+enum class Phase {
+  /*!
+   * @brief VisionClient::ReceivePacket.
+   */
+  kReceive,
+
+  /*!
+   * @brief AutomatedReferee::AnalyzeGameState.
+   */
+  kReferee,
+
+  /*!
+   * @brief Building the global state from the vision frame.
+   */
+  kState,
+
+  /*!
+   * @brief The critic forward pass of a collection time step.
+   */
+  kCriticForward,
+
+  /*!
+   * @brief The policy step of a collection time step, including the local
+   * states.
+   */
+  kPolicyForward,
+
+  /*!
+   * @brief Sending the actions of one team. With the headless simulator this
+   * also steps its physics, since SimulatedCommandChannel::SendPacket runs
+   * the simulation step.
+   */
+  kSendActions,
+
+  /*!
+   * @brief RunState::ComputeRewards.
+   */
+  kRewards,
+
+  /*!
+   * @brief The forward passes over a mini batch.
+   */
+  kUpdateForward,
+
+  /*!
+   * @brief The losses and statistics of a mini batch.
+   */
+  kUpdateLoss,
+
+  /*!
+   * @brief The backward pass, gradient clipping and optimizer steps of a
+   * mini batch.
+   */
+  kUpdateBackward,
+
+  /*!
+   * @brief Saving a checkpoint.
+   */
+  kSave
+};
+
+/*!
+ * @brief Number of values of Phase.
+ */
+const int kNumPhases = static_cast<int>(Phase::kSave) + 1;
+
+/*!
+ * @brief Returns the name of a phase, as written by SavePhaseStatisticsToFile.
+ */
+const char* GetPhaseName(Phase phase);
+
+/*!
+ * @brief Histogram of durations in nanoseconds, with buckets of a relative
+ * width of at most 1/32, as in HDR histograms.
+ *
+ * Durations below 64 ns have a bucket each. Above, each power of two is split
+ * into 32 buckets. Durations from 2^36 ns, about 69 s, land in the last
+ * bucket.
+ *
+ * Record() may only be called by one thread, without locking. Other threads
+ * may read the counts at the same time, and see every recorded duration
+ * eventually.
+ */
+class LatencyHistogram
+{
+ public:
+  /*!
+   * @brief Number of buckets.
+   */
+  static const int kNumBuckets = 1024;
+
+  /*!
+   * @brief Adds one duration.
+   */
+  void Record(uint64_t nanoseconds);
+
+  /*!
+   * @brief Adds the count of every bucket to counts, which has kNumBuckets
+   * entries.
+   */
+  void AddCountsTo(std::vector<uint64_t>& counts) const;
+
+  /*!
+   * @brief Returns the bucket of a duration.
+   */
+  static int ComputeBucket(uint64_t nanoseconds);
+
+  /*!
+   * @brief Returns the largest duration in a bucket.
+   */
+  static uint64_t ComputeBucketUpperBound(int bucket);
+
+ protected:
+  /*!
+   * @brief Number of durations in each bucket.
+   */
+  std::array<std::atomic<uint64_t>, kNumBuckets> counts_{};
+};
+
+/*!
+ * @brief Timer that records the time from its construction to its
+ * destruction as one sample of a phase, into a histogram of the calling
+ * thread. Used through CENTRALISEDAI_TIME_PHASE.
+ */
+class PhaseTimer
+{
+ public:
+  /*!
+   * @brief Constructor that starts the timer.
+   */
+  explicit PhaseTimer(Phase phase);
+
+  /*!
+   * @brief Destructor that records the elapsed time.
+   */
+  ~PhaseTimer();
+
+  PhaseTimer(const PhaseTimer&) = delete;
+  PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+ protected:
+  /*!
+   * @brief The timed phase.
+   */
+  Phase phase_;
+
+  /*!
+   * @brief Time of construction.
+   */
+  std::chrono::steady_clock::time_point start_;
+};
+
+/*!
+ * @brief Records one sample of a phase into the histogram of the calling
+ * thread. The first call on a thread creates its histograms, under a lock;
+ * later calls do not lock. The histograms are kept after the thread exits,
+ * so only long-lived threads such as WorkerPool threads should record.
+ */
+void RecordPhaseTime(Phase phase, uint64_t nanoseconds);
+
+/*!
+ * @brief Percentiles of the samples of one phase.
+ *
+ * Every duration is the upper bound of its bucket, so at most 1/32 above the
+ * recorded duration.
+ */
+struct PhaseStatistics {
+  /*!
+   * @brief The phase.
+   */
+  Phase phase;
+
+  /*!
+   * @brief Number of samples.
+   */
+  uint64_t count;
+
+  /*!
+   * @brief Median, 99th percentile and maximum in microseconds, 0 without
+   * samples.
+   */
+  double p50_us;
+  double p99_us;
+  double max_us;
+};
+
+/*!
+ * @brief Merges the histograms of all threads and returns the statistics of
+ * every phase over the samples recorded since the previous call, e.g. in the
+ * last epoch.
+ *
+ * @returns kNumPhases entries, in the order of Phase.
+ */
+std::vector<PhaseStatistics> CollectPhaseStatistics();
+
+/*!
+ * @brief Appends one line per phase with samples to a CSV file, with the
+ * columns epoch, phase, count, p50_us, p99_us and max_us. A new file starts
+ * with a header line. Missing folders of the file are created.
+ *
+ * @param[in] kStatistics The statistics of one epoch.
+ *
+ * @param[in] epoch The epoch index.
+ *
+ * @param[in] kFileName The file to append to.
+ */
+void SavePhaseStatisticsToFile(const std::vector<PhaseStatistics>& kStatistics,
+                               int32_t epoch, const std::string& kFileName);
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_PHASETIMER_H_ */
@@ -0,0 +1,565 @@
+/* policy_engine.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Header-only inference of one policy time step, without
+ * libtorch, for network sizes fixed at compile time.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYENGINE_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYENGINE_H_
+
+#include "../../src/common_types.h"
+#include "cmath"
+#include "fstream"
+#include "stdexcept"
+#include "stdint.h"
+#include "string"
+#include "vector"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include "immintrin.h"
+#define CENTRALISEDAI_POLICYENGINE_AVX2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include "arm_neon.h"
+#define CENTRALISEDAI_POLICYENGINE_NEON
+#endif
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief First four bytes of a policy weights file, "CPW1" in little endian.
+ */
+const uint32_t kPolicyWeightsMagic = 0x31575043;
+
+/*!
+ * @brief Class that runs one time step of a policy with the architecture of
+ * PolicyNetwork: two Linear + tanh layers, one GRU step and an output Linear.
+ *
+ * The sizes are template parameters, so every loop has a constant trip count.
+ * The weights are stored transposed and padded to whole SIMD registers, and
+ * the matrix-vector products use AVX2 and FMA or NEON when the translation
+ * unit is compiled for them (e.g. with -march=native), and plain loops
+ * otherwise. The SIMD paths also compute tanh and sigmoid on whole registers,
+ * from a polynomial exp with an error of a few ulp, where the plain path
+ * calls the standard library. Either way the outputs match
+ * PolicyNetwork::Forward to within about 1e-6.
+ *
+ * A weights file, written by ExportPolicyWeights, holds kPolicyWeightsMagic,
+ * the three sizes as int32 and then the float32 parameters in the row-major
+ * layout of PyTorch, in the order layer1 weight and bias, layer2 weight and
+ * bias, GRU weight_ih_l0, weight_hh_l0, bias_ih_l0 and bias_hh_l0, and output
+ * layer weight and bias.
+ *
+ * Forward() and Act() are const and do not allocate, so one engine can serve
+ * any number of robots and threads, each with its own hidden state.
+ */
+template <int kInputSize, int kHiddenSize, int kNumActions>
+class PolicyEngine
+{
+ public:
+  /*!
+   * @brief Number of floats in a weights file after the header.
+   */
+  static constexpr int kNumWeights =
+      kHiddenSize * kInputSize + kHiddenSize + kHiddenSize * kHiddenSize +
+      kHiddenSize + 2 * 3 * kHiddenSize * kHiddenSize + 2 * 3 * kHiddenSize +
+      kNumActions * kHiddenSize + kNumActions;
+
+  /*!
+   * @brief Constructor with all weights zero.
+   */
+  PolicyEngine()
+      : layer1_weight_(kInputSize * Padded(kHiddenSize)),
+        layer1_bias_(Padded(kHiddenSize)),
+        layer2_weight_(kHiddenSize * Padded(kHiddenSize)),
+        layer2_bias_(Padded(kHiddenSize)),
+        gru_weight_ih_(kHiddenSize * Padded(3 * kHiddenSize)),
+        gru_weight_hh_(kHiddenSize * Padded(3 * kHiddenSize)),
+        gru_bias_ih_(Padded(3 * kHiddenSize)),
+        gru_bias_hh_(Padded(3 * kHiddenSize)),
+        output_weight_(kHiddenSize * Padded(kNumActions)),
+        output_bias_(Padded(kNumActions)) {}
+
+  /*!
+   * @brief Constructor that takes the weights in the layout of a weights
+   * file.
+   *
+   * @param[in] kWeights kNumWeights floats, without the header.
+   */
+  explicit PolicyEngine(const float* kWeights) : PolicyEngine() {
+    kWeights = Transpose(kWeights, kHiddenSize, kInputSize, layer1_weight_);
+    kWeights = Copy(kWeights, kHiddenSize, layer1_bias_);
+    kWeights = Transpose(kWeights, kHiddenSize, kHiddenSize, layer2_weight_);
+    kWeights = Copy(kWeights, kHiddenSize, layer2_bias_);
+    kWeights =
+        Transpose(kWeights, 3 * kHiddenSize, kHiddenSize, gru_weight_ih_);
+    kWeights =
+        Transpose(kWeights, 3 * kHiddenSize, kHiddenSize, gru_weight_hh_);
+    kWeights = Copy(kWeights, 3 * kHiddenSize, gru_bias_ih_);
+    kWeights = Copy(kWeights, 3 * kHiddenSize, gru_bias_hh_);
+    kWeights = Transpose(kWeights, kNumActions, kHiddenSize, output_weight_);
+    Copy(kWeights, kNumActions, output_bias_);
+  }
+
+  /*!
+   * @brief Loads the weights from a file written by ExportPolicyWeights.
+   *
+   * @param[in] kPath The weights file.
+   *
+   * @throws std::runtime_error if the file could not be read or was written
+   * for other sizes.
+   */
+  static PolicyEngine Load(const std::string& kPath) {
+    std::ifstream file(kPath, std::ios::binary);
+    if (!file) {
+      throw std::runtime_error("Could not open policy weights " + kPath);
+    }
+
+    uint32_t magic = 0;
+    int32_t sizes[3] = {0, 0, 0};
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+    if (!file || magic != kPolicyWeightsMagic) {
+      throw std::runtime_error("Not a policy weights file: " + kPath);
+    }
+    if (sizes[0] != kInputSize || sizes[1] != kHiddenSize ||
+        sizes[2] != kNumActions) {
+      throw std::runtime_error("Policy weights of other sizes in " + kPath);
+    }
+
+    std::vector<float> weights(kNumWeights);
+    file.read(reinterpret_cast<char*>(weights.data()),
+              weights.size() * sizeof(float));
+    if (!file) {
+      throw std::runtime_error("Truncated policy weights file " + kPath);
+    }
+
+    return PolicyEngine(weights.data());
+  }
+
+  /*!
+   * @brief Runs one time step of one robot.
+   *
+   * @param[in] kLocalState The kInputSize local states of the robot.
+   *
+   * @param[in,out] hidden_state The kHiddenSize hidden states of the robot,
+   * which are replaced by those of the next time step.
+   *
+   * @param[out] logits The kNumActions outputs of the policy, before the
+   * softmax.
+   */
+  void Forward(const float* kLocalState, float* hidden_state,
+               float* logits) const {
+    alignas(32) float layer1_output[Padded(kHiddenSize)];
+    alignas(32) float layer2_output[Padded(kHiddenSize)];
+    alignas(32) float input_gates[Padded(3 * kHiddenSize)];
+    alignas(32) float hidden_gates[Padded(3 * kHiddenSize)];
+    alignas(32) float output[Padded(kNumActions)];
+
+    MatVec<kHiddenSize, kInputSize>(layer1_weight_.data(),
+                                    layer1_bias_.data(), kLocalState,
+                                    layer1_output);
+    TanhInPlace<Padded(kHiddenSize)>(layer1_output);
+
+    MatVec<kHiddenSize, kHiddenSize>(layer2_weight_.data(),
+                                     layer2_bias_.data(), layer1_output,
+                                     layer2_output);
+    TanhInPlace<Padded(kHiddenSize)>(layer2_output);
+
+    /* One GRU step, with the gates in the order of torch::nn::GRU */
+    MatVec<3 * kHiddenSize, kHiddenSize>(gru_weight_ih_.data(),
+                                         gru_bias_ih_.data(), layer2_output,
+                                         input_gates);
+    MatVec<3 * kHiddenSize, kHiddenSize>(gru_weight_hh_.data(),
+                                         gru_bias_hh_.data(), hidden_state,
+                                         hidden_gates);
+    GruGates(input_gates, hidden_gates, hidden_state);
+
+    MatVec<kNumActions, kHiddenSize>(output_weight_.data(),
+                                     output_bias_.data(), hidden_state,
+                                     output);
+    for (int i = 0; i < kNumActions; i++) {
+      logits[i] = output[i];
+    }
+  }
+
+  /*!
+   * @brief Runs one time step of one robot and selects its most probable
+   * action.
+   *
+   * @param[in] kLocalState The kInputSize local states of the robot.
+   *
+   * @param[in,out] hidden_state The kHiddenSize hidden states of the robot,
+   * which are replaced by those of the next time step.
+   *
+   * @returns The index of the action with the highest probability.
+   */
+  int Act(const float* kLocalState, float* hidden_state) const {
+    float logits[kNumActions];
+    Forward(kLocalState, hidden_state, logits);
+
+    int action = 0;
+    for (int i = 1; i < kNumActions; i++) {
+      if (logits[i] > logits[action]) {
+        action = i;
+      }
+    }
+
+    return action;
+  }
+
+ protected:
+  /*!
+   * @brief Rounds a number of rows up to whole blocks of 8 floats, one AVX2
+   * register or two NEON registers.
+   */
+  static constexpr int Padded(int rows) { return (rows + 7) / 8 * 8; }
+
+  /*!
+   * @brief Stores a row-major [rows, cols] matrix as [cols, Padded(rows)].
+   *
+   * @returns The element after the matrix.
+   */
+  static const float* Transpose(const float* kMatrix, int rows, int cols,
+                                std::vector<float>& transposed) {
+    int padded_rows = Padded(rows);
+    for (int r = 0; r < rows; r++) {
+      for (int c = 0; c < cols; c++) {
+        transposed[c * padded_rows + r] = kMatrix[r * cols + c];
+      }
+    }
+
+    return kMatrix + rows * cols;
+  }
+
+  /*!
+   * @brief Copies a vector of size elements.
+   *
+   * @returns The element after the vector.
+   */
+  static const float* Copy(const float* kVector, int size,
+                           std::vector<float>& copy) {
+    for (int i = 0; i < size; i++) {
+      copy[i] = kVector[i];
+    }
+
+    return kVector + size;
+  }
+
+#if defined(CENTRALISEDAI_POLICYENGINE_AVX2)
+  /*!
+   * @brief Number of floats in a SIMD register.
+   */
+  static constexpr int kLanes = 8;
+
+  /*!
+   * @brief exp of 8 floats, with the range reduction and polynomial of
+   * Cephes expf.
+   */
+  static __m256 Exp(__m256 x) {
+    x = _mm256_min_ps(x, _mm256_set1_ps(88.3762626647949F));
+    x = _mm256_max_ps(x, _mm256_set1_ps(-88.3762626647949F));
+
+    /* x = n ln(2) + r, with |r| <= ln(2) / 2 */
+    __m256 n = _mm256_floor_ps(_mm256_fmadd_ps(
+        x, _mm256_set1_ps(1.44269504088896341F), _mm256_set1_ps(0.5F)));
+    __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375F), x);
+    r = _mm256_fnmadd_ps(n, _mm256_set1_ps(-2.12194440e-4F), r);
+
+    __m256 y = _mm256_set1_ps(1.9875691500e-4F);
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(1.3981999507e-3F));
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(8.3334519073e-3F));
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(4.1665795894e-2F));
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(1.6666665459e-1F));
+    y = _mm256_fmadd_ps(y, r, _mm256_set1_ps(5.0000001201e-1F));
+    y = _mm256_fmadd_ps(y, _mm256_mul_ps(r, r),
+                        _mm256_add_ps(r, _mm256_set1_ps(1.0F)));
+
+    /* 2^n from the exponent bits */
+    __m256i exponent = _mm256_slli_epi32(
+        _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+
+    return _mm256_mul_ps(y, _mm256_castsi256_ps(exponent));
+  }
+
+  static __m256 Load(const float* kValues) { return _mm256_loadu_ps(kValues); }
+
+  static void Store(float* values, __m256 x) { _mm256_storeu_ps(values, x); }
+
+  static __m256 Set(float value) { return _mm256_set1_ps(value); }
+
+  static __m256 Add(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+
+  static __m256 Sub(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+
+  static __m256 Mul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+
+  static __m256 Div(__m256 a, __m256 b) { return _mm256_div_ps(a, b); }
+
+  /*!
+   * @brief tanh(x) = 1 - 2 / (exp(2x) + 1), of 8 floats.
+   */
+  static __m256 Tanh(__m256 x) {
+    return Sub(Set(1.0F), Div(Set(2.0F), Add(Exp(Add(x, x)), Set(1.0F))));
+  }
+
+  /*!
+   * @brief sigmoid(x) = 1 / (1 + exp(-x)), of 8 floats.
+   */
+  static __m256 Sigmoid(__m256 x) {
+    return Div(Set(1.0F), Add(Set(1.0F), Exp(Sub(Set(0.0F), x))));
+  }
+#elif defined(CENTRALISEDAI_POLICYENGINE_NEON)
+  /*!
+   * @brief Number of floats in a SIMD register.
+   */
+  static constexpr int kLanes = 4;
+
+  /*!
+   * @brief exp of 4 floats, with the range reduction and polynomial of
+   * Cephes expf.
+   */
+  static float32x4_t Exp(float32x4_t x) {
+    x = vminq_f32(x, vdupq_n_f32(88.3762626647949F));
+    x = vmaxq_f32(x, vdupq_n_f32(-88.3762626647949F));
+
+    /* x = n ln(2) + r, with |r| <= ln(2) / 2 */
+    float32x4_t n = vrndmq_f32(vfmaq_f32(
+        vdupq_n_f32(0.5F), x, vdupq_n_f32(1.44269504088896341F)));
+    float32x4_t r = vfmsq_f32(x, n, vdupq_n_f32(0.693359375F));
+    r = vfmsq_f32(r, n, vdupq_n_f32(-2.12194440e-4F));
+
+    float32x4_t y = vdupq_n_f32(1.9875691500e-4F);
+    y = vfmaq_f32(vdupq_n_f32(1.3981999507e-3F), y, r);
+    y = vfmaq_f32(vdupq_n_f32(8.3334519073e-3F), y, r);
+    y = vfmaq_f32(vdupq_n_f32(4.1665795894e-2F), y, r);
+    y = vfmaq_f32(vdupq_n_f32(1.6666665459e-1F), y, r);
+    y = vfmaq_f32(vdupq_n_f32(5.0000001201e-1F), y, r);
+    y = vfmaq_f32(vaddq_f32(r, vdupq_n_f32(1.0F)), y, vmulq_f32(r, r));
+
+    /* 2^n from the exponent bits */
+    int32x4_t exponent =
+        vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127)), 23);
+
+    return vmulq_f32(y, vreinterpretq_f32_s32(exponent));
+  }
+
+  static float32x4_t Load(const float* kValues) { return vld1q_f32(kValues); }
+
+  static void Store(float* values, float32x4_t x) { vst1q_f32(values, x); }
+
+  static float32x4_t Set(float value) { return vdupq_n_f32(value); }
+
+  static float32x4_t Add(float32x4_t a, float32x4_t b) {
+    return vaddq_f32(a, b);
+  }
+
+  static float32x4_t Sub(float32x4_t a, float32x4_t b) {
+    return vsubq_f32(a, b);
+  }
+
+  static float32x4_t Mul(float32x4_t a, float32x4_t b) {
+    return vmulq_f32(a, b);
+  }
+
+  static float32x4_t Div(float32x4_t a, float32x4_t b) {
+    return vdivq_f32(a, b);
+  }
+
+  /*!
+   * @brief tanh(x) = 1 - 2 / (exp(2x) + 1), of 4 floats.
+   */
+  static float32x4_t Tanh(float32x4_t x) {
+    return Sub(Set(1.0F), Div(Set(2.0F), Add(Exp(Add(x, x)), Set(1.0F))));
+  }
+
+  /*!
+   * @brief sigmoid(x) = 1 / (1 + exp(-x)), of 4 floats.
+   */
+  static float32x4_t Sigmoid(float32x4_t x) {
+    return Div(Set(1.0F), Add(Set(1.0F), Exp(vnegq_f32(x))));
+  }
+#else
+  /*!
+   * @brief Number of floats handled together, one without SIMD.
+   */
+  static constexpr int kLanes = 1;
+
+  static float Load(const float* kValues) { return *kValues; }
+
+  static void Store(float* values, float x) { *values = x; }
+
+  static float Set(float value) { return value; }
+
+  static float Add(float a, float b) { return a + b; }
+
+  static float Sub(float a, float b) { return a - b; }
+
+  static float Mul(float a, float b) { return a * b; }
+
+  static float Tanh(float x) { return std::tanh(x); }
+
+  static float Sigmoid(float x) { return 1.0F / (1.0F + std::exp(-x)); }
+#endif
+
+  /*!
+   * @brief Applies tanh to kSize values, a multiple of kLanes.
+   */
+  template <int kSize>
+  static void TanhInPlace(float* values) {
+    static_assert(kSize % kLanes == 0, "Not whole SIMD registers");
+    for (int i = 0; i < kSize; i += kLanes) {
+      Store(values + i, Tanh(Load(values + i)));
+    }
+  }
+
+  /*!
+   * @brief Combines the gate pre-activations of a GRU step into the next
+   * hidden state:
+   * r = sigmoid(input_r + hidden_r)
+   * z = sigmoid(input_z + hidden_z)
+   * n = tanh(input_n + r * hidden_n)
+   * h' = n + z * (h - n)
+   *
+   * @param[in] kInputGates Gates from the input, 3 * kHiddenSize values.
+   *
+   * @param[in] kHiddenGates Gates from the hidden state, 3 * kHiddenSize
+   * values.
+   *
+   * @param[in,out] hidden_state kHiddenSize values, h in and h' out.
+   */
+  static void GruGates(const float* kInputGates, const float* kHiddenGates,
+                       float* hidden_state) {
+    constexpr int kVectorized = kHiddenSize / kLanes * kLanes;
+
+    for (int i = 0; i < kVectorized; i += kLanes) {
+      auto reset = Sigmoid(Add(Load(kInputGates + i), Load(kHiddenGates + i)));
+      auto update = Sigmoid(Add(Load(kInputGates + kHiddenSize + i),
+                                Load(kHiddenGates + kHiddenSize + i)));
+      auto candidate =
+          Tanh(Add(Load(kInputGates + 2 * kHiddenSize + i),
+                   Mul(reset, Load(kHiddenGates + 2 * kHiddenSize + i))));
+      auto hidden = Load(hidden_state + i);
+      Store(hidden_state + i,
+            Add(candidate, Mul(update, Sub(hidden, candidate))));
+    }
+
+    /* The rest of a hidden size that is not whole registers */
+    for (int i = kVectorized; i < kHiddenSize; i++) {
+      float reset =
+          1.0F / (1.0F + std::exp(-(kInputGates[i] + kHiddenGates[i])));
+      float update =
+          1.0F / (1.0F + std::exp(-(kInputGates[kHiddenSize + i] +
+                                    kHiddenGates[kHiddenSize + i])));
+      float candidate = std::tanh(kInputGates[2 * kHiddenSize + i] +
+                                  reset * kHiddenGates[2 * kHiddenSize + i]);
+      hidden_state[i] = candidate + update * (hidden_state[i] - candidate);
+    }
+  }
+
+  /*!
+   * @brief Computes output = W x + b for all Padded(kRows) rows.
+   *
+   * @param[in] kWeights W as [kCols, Padded(kRows)].
+   *
+   * @param[in] kBias b, with Padded(kRows) elements.
+   *
+   * @param[in] kInput x, with kCols elements.
+   *
+   * @param[out] output Padded(kRows) elements.
+   */
+  template <int kRows, int kCols>
+  static void MatVec(const float* kWeights, const float* kBias,
+                     const float* kInput, float* output) {
+    constexpr int kPaddedRows = Padded(kRows);
+
+#if defined(CENTRALISEDAI_POLICYENGINE_AVX2)
+    /* Four independent accumulators hide the latency of the FMA */
+    int row = 0;
+    for (; row + 32 <= kPaddedRows; row += 32) {
+      __m256 sum0 = _mm256_loadu_ps(kBias + row);
+      __m256 sum1 = _mm256_loadu_ps(kBias + row + 8);
+      __m256 sum2 = _mm256_loadu_ps(kBias + row + 16);
+      __m256 sum3 = _mm256_loadu_ps(kBias + row + 24);
+      for (int col = 0; col < kCols; col++) {
+        const float* kColumn = kWeights + col * kPaddedRows + row;
+        __m256 x = _mm256_broadcast_ss(kInput + col);
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(kColumn), x, sum0);
+        sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(kColumn + 8), x, sum1);
+        sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(kColumn + 16), x, sum2);
+        sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(kColumn + 24), x, sum3);
+      }
+      _mm256_storeu_ps(output + row, sum0);
+      _mm256_storeu_ps(output + row + 8, sum1);
+      _mm256_storeu_ps(output + row + 16, sum2);
+      _mm256_storeu_ps(output + row + 24, sum3);
+    }
+    for (; row < kPaddedRows; row += 8) {
+      __m256 sum = _mm256_loadu_ps(kBias + row);
+      for (int col = 0; col < kCols; col++) {
+        sum = _mm256_fmadd_ps(
+            _mm256_loadu_ps(kWeights + col * kPaddedRows + row),
+            _mm256_broadcast_ss(kInput + col), sum);
+      }
+      _mm256_storeu_ps(output + row, sum);
+    }
+#elif defined(CENTRALISEDAI_POLICYENGINE_NEON)
+    for (int row = 0; row < kPaddedRows; row += 8) {
+      float32x4_t sum0 = vld1q_f32(kBias + row);
+      float32x4_t sum1 = vld1q_f32(kBias + row + 4);
+      for (int col = 0; col < kCols; col++) {
+        const float* kColumn = kWeights + col * kPaddedRows + row;
+        float32x4_t x = vdupq_n_f32(kInput[col]);
+        sum0 = vfmaq_f32(sum0, vld1q_f32(kColumn), x);
+        sum1 = vfmaq_f32(sum1, vld1q_f32(kColumn + 4), x);
+      }
+      vst1q_f32(output + row, sum0);
+      vst1q_f32(output + row + 4, sum1);
+    }
+#else
+    /* Column by column, so the inner loop is contiguous */
+    for (int row = 0; row < kPaddedRows; row++) {
+      output[row] = kBias[row];
+    }
+    for (int col = 0; col < kCols; col++) {
+      const float* kColumn = kWeights + col * kPaddedRows;
+      for (int row = 0; row < kPaddedRows; row++) {
+        output[row] += kColumn[row] * kInput[col];
+      }
+    }
+#endif
+  }
+
+  /*!
+   * @brief Weights, transposed to [inputs, Padded(outputs)], and biases,
+   * padded to Padded(outputs), of each layer. The padding is zero.
+   */
+  std::vector<float> layer1_weight_;
+  std::vector<float> layer1_bias_;
+  std::vector<float> layer2_weight_;
+  std::vector<float> layer2_bias_;
+  std::vector<float> gru_weight_ih_;
+  std::vector<float> gru_weight_hh_;
+  std::vector<float> gru_bias_ih_;
+  std::vector<float> gru_bias_hh_;
+  std::vector<float> output_weight_;
+  std::vector<float> output_bias_;
+};
+
+/*!
+ * @brief The engine for the sizes of PolicyNetwork.
+ */
+using DefaultPolicyEngine =
+    PolicyEngine<num_local_states, hidden_size, num_actions>;
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYENGINE_H_ */
@@ -0,0 +1,138 @@
+/* policy_export.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Export of the policy network to a frozen TorchScript module or
+ * a weights file for inference, and loading of exported policies.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "policy_export.h"
+#include "../../src/common_types.h"
+#include "fstream"
+#include "network.h"
+#include "policy_engine.h"
+#include "stdint.h"
+#include "string"
+#include "torch/script.h"
+#include "torch/torch.h"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* One time step of PolicyNetwork::Forward followed by a log_softmax, with
+ * torch.gru_cell for the single layer GRU */
+static const char* const kPolicySource = R"JIT(
+def forward(self, local_states: Tensor, hidden_states: Tensor) -> Tuple[Tensor, Tensor]:
+    x = torch.tanh(torch.linear(local_states, self.layer1_weight, self.layer1_bias))
+    x = torch.tanh(torch.linear(x, self.layer2_weight, self.layer2_bias))
+    h = torch.gru_cell(x, hidden_states, self.rnn_weight_ih, self.rnn_weight_hh, self.rnn_bias_ih, self.rnn_bias_hh)
+    logits = torch.linear(h, self.output_weight, self.output_bias)
+    return torch.log_softmax(logits, 1), h
+)JIT";
+
+torch::jit::Module ScriptPolicy(const PolicyNetwork& kPolicy) {
+  torch::NoGradGuard no_grad;
+
+  torch::OrderedDict<std::string, torch::Tensor> gru_parameters =
+      kPolicy.rnn->named_parameters();
+
+  /* Copies, so later updates of the policy do not change the module */
+  torch::jit::Module module("PolicyModule");
+  module.register_parameter("layer1_weight",
+                            kPolicy.layer1->weight.detach().clone(), false);
+  module.register_parameter("layer1_bias",
+                            kPolicy.layer1->bias.detach().clone(), false);
+  module.register_parameter("layer2_weight",
+                            kPolicy.layer2->weight.detach().clone(), false);
+  module.register_parameter("layer2_bias",
+                            kPolicy.layer2->bias.detach().clone(), false);
+  module.register_parameter(
+      "rnn_weight_ih", gru_parameters["weight_ih_l0"].detach().clone(), false);
+  module.register_parameter(
+      "rnn_weight_hh", gru_parameters["weight_hh_l0"].detach().clone(), false);
+  module.register_parameter(
+      "rnn_bias_ih", gru_parameters["bias_ih_l0"].detach().clone(), false);
+  module.register_parameter(
+      "rnn_bias_hh", gru_parameters["bias_hh_l0"].detach().clone(), false);
+  module.register_parameter(
+      "output_weight", kPolicy.output_layer->weight.detach().clone(), false);
+  module.register_parameter(
+      "output_bias", kPolicy.output_layer->bias.detach().clone(), false);
+
+  module.define(kPolicySource);
+  module.eval();
+
+  return module;
+}
+
+torch::jit::Module ExportPolicy(const PolicyNetwork& kPolicy,
+                                const std::string& kPath) {
+  /* Freezing inlines the parameters as constants, which lets
+   * optimize_for_inference fold and fuse the Linear, tanh and GRU ops */
+  torch::jit::Module frozen = torch::jit::freeze(ScriptPolicy(kPolicy));
+  torch::jit::optimize_for_inference(frozen);
+
+  frozen.save(kPath);
+
+  return frozen;
+}
+
+torch::jit::Module LoadExportedPolicy(const std::string& kPath) {
+  try {
+    torch::jit::Module module = torch::jit::load(kPath);
+    module.eval();
+    std::cout << "Loading exported policy from " << kPath << std::endl;
+
+    return module;
+  } catch (const std::exception& kException) {
+    std::cerr << "Error loading exported policy: " << kException.what()
+              << std::endl;
+
+    throw std::runtime_error("Error loading exported policy");
+  }
+}
+
+void ExportPolicyWeights(const PolicyNetwork& kPolicy,
+                         const std::string& kPath) {
+  torch::NoGradGuard no_grad;
+
+  torch::OrderedDict<std::string, torch::Tensor> gru_parameters =
+      kPolicy.rnn->named_parameters();
+
+  /* Row-major float32, in the order PolicyEngine reads them */
+  std::vector<torch::Tensor> parameters = {
+      kPolicy.layer1->weight.flatten(),
+      kPolicy.layer1->bias,
+      kPolicy.layer2->weight.flatten(),
+      kPolicy.layer2->bias,
+      gru_parameters["weight_ih_l0"].flatten(),
+      gru_parameters["weight_hh_l0"].flatten(),
+      gru_parameters["bias_ih_l0"],
+      gru_parameters["bias_hh_l0"],
+      kPolicy.output_layer->weight.flatten(),
+      kPolicy.output_layer->bias};
+  torch::Tensor weights =
+      torch::cat(parameters).to(torch::kFloat).contiguous();
+  assert(weights.numel() == DefaultPolicyEngine::kNumWeights);
+
+  std::ofstream file(kPath, std::ios::binary);
+  int32_t sizes[3] = {num_local_states, hidden_size, num_actions};
+  file.write(reinterpret_cast<const char*>(&kPolicyWeightsMagic),
+             sizeof(kPolicyWeightsMagic));
+  file.write(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+  file.write(reinterpret_cast<const char*>(weights.data_ptr<float>()),
+             weights.numel() * sizeof(float));
+
+  if (!file) {
+    throw std::runtime_error("Error writing policy weights to " + kPath);
+  }
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,88 @@
+/* policy_export.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Export of the policy network to a frozen TorchScript module or
+ * a weights file for inference, and loading of exported policies.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYEXPORT_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYEXPORT_H_
+
+#include "network.h"
+#include "string"
+#include "torch/script.h"
+#include "torch/torch.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief Path that MappoTrainer::SaveCheckpoint exports the policy to.
+ */
+const std::string kExportedPolicyPath = "../models/policy_inference.pt";
+
+/*!
+ * @brief Creates a TorchScript module that runs one time step of a policy.
+ *
+ * The module holds copies of the parameters of the policy and has the method
+ * forward(local_states, hidden_states) -> (log_probabilities, hidden_states),
+ * with the shapes [N, num_local_states] and [N, hidden_size] in and
+ * [N, num_actions] and [N, hidden_size] out. The log-probabilities are the
+ * log_softmax of PolicyNetwork::Forward.
+ *
+ * @param[in] kPolicy The policy network to copy.
+ *
+ * @returns The scripted module, in eval mode and not frozen.
+ */
+torch::jit::Module ScriptPolicy(const PolicyNetwork& kPolicy);
+
+/*!
+ * @brief Scripts a policy with ScriptPolicy, freezes it so the parameters
+ * become constants of the graph, optimizes the graph for inference and saves
+ * it.
+ *
+ * @param[in] kPolicy The policy network to export.
+ *
+ * @param[in] kPath The file to save the module to.
+ *
+ * @returns The frozen and optimized module.
+ *
+ * @throws c10::Error if the module could not be saved.
+ */
+torch::jit::Module ExportPolicy(const PolicyNetwork& kPolicy,
+                                const std::string& kPath);
+
+/*!
+ * @brief Loads a policy exported with ExportPolicy.
+ *
+ * @param[in] kPath The file the module was saved to.
+ *
+ * @returns The module, in eval mode.
+ *
+ * @throws std::runtime_error if the file could not be loaded.
+ */
+torch::jit::Module LoadExportedPolicy(const std::string& kPath);
+
+/*!
+ * @brief Writes the parameters of a policy to a weights file for
+ * PolicyEngine, in the format described there.
+ *
+ * @param[in] kPolicy The policy network to export.
+ *
+ * @param[in] kPath The file to write.
+ *
+ * @throws std::runtime_error if the file could not be written.
+ */
+void ExportPolicyWeights(const PolicyNetwork& kPolicy,
+                         const std::string& kPath);
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYEXPORT_H_ */
@@ -0,0 +1,323 @@
+/* policy_quantization.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Quantization of the policy network to the fixed point format
+ * of fixed_point_policy.h, and export of it as C source for the robots.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "policy_quantization.h"
+#include "../../src/common_types.h"
+#include "algorithm"
+#include "cctype"
+#include "cmath"
+#include "communication.h"
+#include "fixed_point_policy.h"
+#include "fstream"
+#include "network.h"
+#include "rollout_storage.h"
+#include "stdint.h"
+#include "string"
+#include "torch/torch.h"
+#include "tuple"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Rounds value * 2^frac_bits to the nearest integer in [min, max] */
+static int64_t QuantizeValue(double value, int frac_bits, int64_t min,
+                             int64_t max) {
+  return std::clamp<int64_t>(std::llround(std::ldexp(value, frac_bits)), min,
+                             max);
+}
+
+/* Samples a function at -8 + i / 16 in Q3.12 */
+template <typename Function>
+static std::vector<int16_t> CreateTable(Function function) {
+  std::vector<int16_t> table(FIXED_POINT_POLICY_TABLE_SIZE);
+  for (int i = 0; i < FIXED_POINT_POLICY_TABLE_SIZE; i++) {
+    table[i] = static_cast<int16_t>(
+        QuantizeValue(function(-8.0 + i / 16.0), FIXED_POINT_POLICY_FRAC_BITS,
+                      INT16_MIN, INT16_MAX));
+  }
+
+  return table;
+}
+
+QuantizedPolicy::QuantizedPolicy(const PolicyNetwork& kPolicy,
+                                 const torch::Tensor& kCalibrationStates) {
+  torch::NoGradGuard no_grad;
+
+  /* For every local state, the largest scale at which all its calibration
+   * values fit in an int16. Positions in mm and orientations in radians
+   * differ by three orders of magnitude, so one scale for all would round
+   * the orientations away. */
+  torch::Tensor max_inputs = kCalibrationStates.reshape({-1, num_local_states})
+                                 .abs()
+                                 .amax(0)
+                                 .to(torch::kDouble)
+                                 .contiguous();
+  const double* kMaxInputData = max_inputs.data_ptr<double>();
+  input_frac_bits_.resize(num_local_states);
+  std::vector<double> column_scales(num_local_states);
+  for (int i = 0; i < num_local_states; i++) {
+    int frac_bits =
+        kMaxInputData[i] > 0
+            ? static_cast<int>(std::floor(std::log2(INT16_MAX /
+                                                    kMaxInputData[i])))
+            : FIXED_POINT_POLICY_FRAC_BITS;
+    input_frac_bits_[i] = static_cast<int8_t>(std::clamp(frac_bits, -16, 14));
+    column_scales[i] = std::ldexp(1.0, -input_frac_bits_[i]);
+  }
+
+  torch::OrderedDict<std::string, torch::Tensor> gru_parameters =
+      kPolicy.rnn->named_parameters();
+
+  /* Column i of layer1 is divided by the scale of its local state, so the
+   * sums are in the units of the float layer and every column is quantized
+   * relative to what it adds to the sum */
+  layer1_ = QuantizeLayer(kPolicy.layer1->weight.detach().to(torch::kDouble) *
+                              torch::tensor(column_scales, torch::kDouble),
+                          kPolicy.layer1->bias, 0);
+  layer2_ = QuantizeLayer(kPolicy.layer2->weight, kPolicy.layer2->bias,
+                          FIXED_POINT_POLICY_FRAC_BITS);
+  gru_input_ = QuantizeLayer(gru_parameters["weight_ih_l0"],
+                             gru_parameters["bias_ih_l0"],
+                             FIXED_POINT_POLICY_FRAC_BITS);
+  gru_hidden_ = QuantizeLayer(gru_parameters["weight_hh_l0"],
+                              gru_parameters["bias_hh_l0"],
+                              FIXED_POINT_POLICY_FRAC_BITS);
+  output_ = QuantizeLayer(kPolicy.output_layer->weight,
+                          kPolicy.output_layer->bias,
+                          FIXED_POINT_POLICY_FRAC_BITS);
+
+  tanh_table_ = CreateTable([](double x) { return std::tanh(x); });
+  sigmoid_table_ =
+      CreateTable([](double x) { return 1.0 / (1.0 + std::exp(-x)); });
+
+  model_.num_inputs = num_local_states;
+  model_.hidden_size = hidden_size;
+  model_.num_actions = num_actions;
+  model_.input_frac_bits = input_frac_bits_.data();
+  model_.layer1 = ToLayer(layer1_);
+  model_.layer2 = ToLayer(layer2_);
+  model_.gru_input = ToLayer(gru_input_);
+  model_.gru_hidden = ToLayer(gru_hidden_);
+  model_.output = ToLayer(output_);
+  model_.tanh_table = tanh_table_.data();
+  model_.sigmoid_table = sigmoid_table_.data();
+}
+
+QuantizedPolicy::LayerData
+QuantizedPolicy::QuantizeLayer(const torch::Tensor& kWeights,
+                               const torch::Tensor& kBiases,
+                               int input_frac_bits) {
+  torch::Tensor weights = kWeights.detach().to(torch::kDouble).contiguous();
+  torch::Tensor biases = kBiases.detach().to(torch::kDouble).contiguous();
+
+  LayerData layer;
+  layer.rows = static_cast<int16_t>(weights.size(0));
+  layer.cols = static_cast<int16_t>(weights.size(1));
+  layer.weights.resize(layer.rows * layer.cols);
+  layer.biases.resize(layer.rows);
+  layer.shifts.resize(layer.rows);
+
+  const double* kWeightData = weights.data_ptr<double>();
+  const double* kBiasData = biases.data_ptr<double>();
+  for (int r = 0; r < layer.rows; r++) {
+    const double* kRow = kWeightData + r * layer.cols;
+    double max_weight = 0;
+    for (int c = 0; c < layer.cols; c++) {
+      max_weight = std::max(max_weight, std::abs(kRow[c]));
+    }
+
+    /* The largest scale at which the row fits in int8, limited so that the
+     * bias fits in an int32 with room for the sum */
+    int frac_bits =
+        max_weight > 0
+            ? static_cast<int>(std::floor(std::log2(INT8_MAX / max_weight)))
+            : 0;
+    if (kBiasData[r] != 0) {
+      frac_bits = std::min(
+          frac_bits, static_cast<int>(std::floor(std::log2(
+                         (1 << 30) / std::abs(kBiasData[r])))) -
+                         input_frac_bits);
+    }
+    /* Keeps the shift to Q3.12 within 32 bits */
+    frac_bits =
+        std::clamp(frac_bits, FIXED_POINT_POLICY_FRAC_BITS - input_frac_bits - 8,
+                   FIXED_POINT_POLICY_FRAC_BITS - input_frac_bits + 24);
+
+    for (int c = 0; c < layer.cols; c++) {
+      layer.weights[r * layer.cols + c] = static_cast<int8_t>(
+          QuantizeValue(kRow[c], frac_bits, -INT8_MAX, INT8_MAX));
+    }
+    layer.biases[r] = static_cast<int32_t>(
+        QuantizeValue(kBiasData[r], frac_bits + input_frac_bits, INT32_MIN,
+                      INT32_MAX));
+    layer.shifts[r] = static_cast<int8_t>(frac_bits + input_frac_bits -
+                                          FIXED_POINT_POLICY_FRAC_BITS);
+  }
+
+  return layer;
+}
+
+FixedPointLayer QuantizedPolicy::ToLayer(const LayerData& kLayer) {
+  FixedPointLayer layer;
+  layer.rows = kLayer.rows;
+  layer.cols = kLayer.cols;
+  layer.weights = kLayer.weights.data();
+  layer.biases = kLayer.biases.data();
+  layer.shifts = kLayer.shifts.data();
+
+  return layer;
+}
+
+const FixedPointPolicy& QuantizedPolicy::GetModel() const { return model_; }
+
+torch::Tensor QuantizedPolicy::Act(const torch::Tensor& kLocalStates) const {
+  torch::Tensor local_states = kLocalStates.to(torch::kFloat).contiguous();
+  int64_t num_time_steps = local_states.size(0);
+  int64_t num_robots = local_states.size(1);
+  torch::Tensor actions =
+      torch::empty({num_time_steps, num_robots}, torch::kLong);
+
+  const float* kStateData = local_states.data_ptr<float>();
+  int64_t* action_data = actions.data_ptr<int64_t>();
+  std::vector<int16_t> input(num_local_states);
+  std::vector<int16_t> hidden_state(hidden_size);
+  for (int64_t robot = 0; robot < num_robots; robot++) {
+    std::fill(hidden_state.begin(), hidden_state.end(), 0);
+
+    for (int64_t t = 0; t < num_time_steps; t++) {
+      const float* kState =
+          kStateData + (t * num_robots + robot) * num_local_states;
+      for (int i = 0; i < num_local_states; i++) {
+        input[i] = FixedPointPolicyQuantizeInput(&model_, i, kState[i]);
+      }
+
+      action_data[t * num_robots + robot] =
+          FixedPointPolicyAct(&model_, input.data(), hidden_state.data());
+    }
+  }
+
+  return actions;
+}
+
+/* Writes an array as a static const C array */
+template <typename Value>
+static void WriteArray(std::ofstream& file, const std::string& kType,
+                       const std::string& kName,
+                       const std::vector<Value>& kValues) {
+  file << "static const " << kType << " " << kName << "[" << kValues.size()
+       << "] = {";
+  for (size_t i = 0; i < kValues.size(); i++) {
+    file << (i % 12 == 0 ? "\n    " : " ") << static_cast<int64_t>(kValues[i])
+         << (i + 1 < kValues.size() ? "," : "");
+  }
+  file << "\n};\n\n";
+}
+
+void QuantizedPolicy::ExportSource(const std::string& kDirectory,
+                                   const std::string& kName) const {
+  std::string guard = kName;
+  std::transform(guard.begin(), guard.end(), guard.begin(),
+                 [](unsigned char c) { return std::toupper(c); });
+  guard += "_H_";
+
+  std::ofstream header(kDirectory + "/" + kName + ".h");
+  header << "/* " << kName << ".h\n"
+         << " * Generated by QuantizedPolicy::ExportSource. Do not edit.\n"
+         << " */\n\n"
+         << "#ifndef " << guard << "\n"
+         << "#define " << guard << "\n\n"
+         << "#include \"fixed_point_policy.h\"\n\n"
+         << "#ifdef __cplusplus\n"
+         << "extern \"C\" {\n"
+         << "#endif\n\n"
+         << "extern const FixedPointPolicy " << kName << ";\n\n"
+         << "#ifdef __cplusplus\n"
+         << "}\n"
+         << "#endif\n\n"
+         << "#endif /* " << guard << " */\n";
+  if (!header) {
+    throw std::runtime_error("Error writing " + kName + ".h");
+  }
+
+  std::ofstream source(kDirectory + "/" + kName + ".c");
+  source << "/* " << kName << ".c\n"
+         << " * Generated by QuantizedPolicy::ExportSource. Do not edit.\n"
+         << " */\n\n"
+         << "#include \"" << kName << ".h\"\n"
+         << "#include \"fixed_point_policy.h\"\n"
+         << "#include \"stdint.h\"\n\n";
+
+  std::vector<std::tuple<std::string, const LayerData*>> layers = {
+      {"layer1", &layer1_},
+      {"layer2", &layer2_},
+      {"gru_input", &gru_input_},
+      {"gru_hidden", &gru_hidden_},
+      {"output", &output_}};
+  for (const auto& [kLayerName, kLayer] : layers) {
+    WriteArray(source, "int8_t", kName + "_" + kLayerName + "_weights",
+               kLayer->weights);
+    WriteArray(source, "int32_t", kName + "_" + kLayerName + "_biases",
+               kLayer->biases);
+    WriteArray(source, "int8_t", kName + "_" + kLayerName + "_shifts",
+               kLayer->shifts);
+  }
+  WriteArray(source, "int8_t", kName + "_input_frac_bits", input_frac_bits_);
+  WriteArray(source, "int16_t", kName + "_tanh_table", tanh_table_);
+  WriteArray(source, "int16_t", kName + "_sigmoid_table", sigmoid_table_);
+
+  source << "const FixedPointPolicy " << kName << " = {\n"
+         << "    " << model_.num_inputs << ", " << model_.hidden_size << ", "
+         << model_.num_actions << ", " << kName << "_input_frac_bits,\n";
+  for (const auto& [kLayerName, kLayer] : layers) {
+    std::string prefix = kName + "_" + kLayerName;
+    source << "    {" << kLayer->rows << ", " << kLayer->cols << ", " << prefix
+           << "_weights, " << prefix << "_biases, " << prefix
+           << "_shifts},\n";
+  }
+  source << "    " << kName << "_tanh_table,\n"
+         << "    " << kName << "_sigmoid_table\n"
+         << "};\n";
+  if (!source) {
+    throw std::runtime_error("Error writing " + kName + ".c");
+  }
+}
+
+torch::Tensor ComputeCalibrationStates(const RolloutStorage& kRollout) {
+  /* [T, episodes, agents, num_local_states] */
+  torch::Tensor local_states =
+      ComputeLocalStates(kRollout.GetStates().transpose(0, 1));
+
+  return local_states.reshape({kRollout.NumTimeSteps(), -1, num_local_states});
+}
+
+double ComputeActionAgreement(PolicyNetwork& policy,
+                              const QuantizedPolicy& kQuantizedPolicy,
+                              const torch::Tensor& kLocalStates) {
+  torch::NoGradGuard no_grad;
+
+  torch::Tensor hidden_states =
+      torch::zeros({1, kLocalStates.size(1), hidden_size});
+  torch::Tensor expected_actions =
+      std::get<0>(policy.ForwardSequence(kLocalStates, hidden_states))
+          .argmax(2);
+
+  return kQuantizedPolicy.Act(kLocalStates)
+      .eq(expected_actions)
+      .to(torch::kDouble)
+      .mean()
+      .item<double>();
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,189 @@
+/* policy_quantization.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Quantization of the policy network to the fixed point format
+ * of fixed_point_policy.h, and export of it as C source for the robots.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYQUANTIZATION_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYQUANTIZATION_H_
+
+#include "fixed_point_policy.h"
+#include "network.h"
+#include "rollout_storage.h"
+#include "stdint.h"
+#include "string"
+#include "torch/torch.h"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief Class that holds a policy network quantized to fixed point.
+ *
+ * Every Linear layer and both GRU weight matrices get int8 weights with a
+ * power of two scale per output row, and int32 biases. The activations and
+ * hidden states are int16 in Q3.12, and tanh and sigmoid are read from
+ * tables. Every int16 local state has its own scale, chosen so that its
+ * largest calibration value fits, and the columns of layer1 are divided by
+ * the scales of their local states before the weights are quantized.
+ *
+ * GetModel() runs on the arrays held by this object, with the same C code
+ * that runs on the robots, and ExportSource() writes the same arrays as a C
+ * source and header pair.
+ *
+ * @note Not copyable, not moveable, since the model points into the arrays.
+ */
+class QuantizedPolicy
+{
+ public:
+  /*!
+   * @brief Constructor that quantizes a policy.
+   *
+   * @param[in] kPolicy The policy network to quantize.
+   *
+   * @param[in] kCalibrationStates Local states the policy acts on, with the
+   * shape [..., num_local_states], e.g. from ComputeCalibrationStates.
+   */
+  QuantizedPolicy(const PolicyNetwork& kPolicy,
+                  const torch::Tensor& kCalibrationStates);
+
+  QuantizedPolicy(const QuantizedPolicy&) = delete;
+  QuantizedPolicy& operator=(const QuantizedPolicy&) = delete;
+
+  /*!
+   * @brief Returns the quantized policy, for FixedPointPolicyForward and
+   * FixedPointPolicyAct.
+   */
+  const FixedPointPolicy& GetModel() const;
+
+  /*!
+   * @brief Selects the actions of a batch of robots over a sequence of time
+   * steps with the quantized policy, starting from zero hidden states.
+   *
+   * @param[in] kLocalStates Local states, with the shape [time_steps,
+   * num_robots, num_local_states].
+   *
+   * @returns The indices of the actions, with the shape [time_steps,
+   * num_robots].
+   */
+  torch::Tensor Act(const torch::Tensor& kLocalStates) const;
+
+  /*!
+   * @brief Writes the quantized policy as kName.h and kName.c, which define
+   * the constant FixedPointPolicy kName. They are compiled together with
+   * fixed_point_policy.h and fixed_point_policy.c.
+   *
+   * @param[in] kDirectory Existing directory to write the files to.
+   *
+   * @param[in] kName Name of the files and of the model, a C identifier.
+   *
+   * @throws std::runtime_error if a file could not be written.
+   */
+  void ExportSource(const std::string& kDirectory,
+                    const std::string& kName) const;
+
+ protected:
+  /*!
+   * @brief The arrays of one FixedPointLayer.
+   */
+  struct LayerData {
+    /*!
+     * @brief Number of outputs and inputs.
+     */
+    int16_t rows;
+    int16_t cols;
+
+    /*!
+     * @brief Weights, row-major [rows, cols].
+     */
+    std::vector<int8_t> weights;
+
+    /*!
+     * @brief Biases, at the scale of the sums of their rows.
+     */
+    std::vector<int32_t> biases;
+
+    /*!
+     * @brief Right shift from the sum of each row to Q3.12.
+     */
+    std::vector<int8_t> shifts;
+  };
+
+  /*!
+   * @brief Quantizes the weights [rows, cols] and biases [rows] of a layer,
+   * whose input has input_frac_bits fractional bits.
+   */
+  static LayerData QuantizeLayer(const torch::Tensor& kWeights,
+                                 const torch::Tensor& kBiases,
+                                 int input_frac_bits);
+
+  /*!
+   * @brief Returns a FixedPointLayer that points into layer.
+   */
+  static FixedPointLayer ToLayer(const LayerData& kLayer);
+
+  /*!
+   * @brief The arrays of every layer.
+   */
+  LayerData layer1_;
+  LayerData layer2_;
+  LayerData gru_input_;
+  LayerData gru_hidden_;
+  LayerData output_;
+
+  /*!
+   * @brief Number of fractional bits of each local state.
+   */
+  std::vector<int8_t> input_frac_bits_;
+
+  /*!
+   * @brief tanh and sigmoid tables, FIXED_POINT_POLICY_TABLE_SIZE entries.
+   */
+  std::vector<int16_t> tanh_table_;
+  std::vector<int16_t> sigmoid_table_;
+
+  /*!
+   * @brief The model, which points into the arrays above.
+   */
+  FixedPointPolicy model_;
+};
+
+/*!
+ * @brief Returns the local states of all robots in all episodes of a rollout,
+ * to calibrate a QuantizedPolicy and measure its action agreement.
+ *
+ * @returns The local states, with the shape [num_time_steps, num_episodes *
+ * amount_of_players_in_team, num_local_states].
+ */
+torch::Tensor ComputeCalibrationStates(const RolloutStorage& kRollout);
+
+/*!
+ * @brief Computes the fraction of time steps in which a quantized policy
+ * selects the same action as the float policy.
+ *
+ * @param[in] policy The float policy network.
+ *
+ * @param[in] kQuantizedPolicy The quantized policy.
+ *
+ * @param[in] kLocalStates Sequences of local states, with the shape
+ * [time_steps, num_robots, num_local_states]. Every robot starts with zero
+ * hidden states.
+ *
+ * @returns The agreement rate, in [0, 1].
+ */
+double ComputeActionAgreement(PolicyNetwork& policy,
+                              const QuantizedPolicy& kQuantizedPolicy,
+                              const torch::Tensor& kLocalStates);
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYQUANTIZATION_H_ */
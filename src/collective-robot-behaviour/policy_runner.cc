@@ -0,0 +1,181 @@
+/* policy_runner.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Action selection with the policy network, running in inference
+ * mode on tensors that are allocated once.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "policy_runner.h"
+#include "../../src/common_types.h"
+#include "dynamic_quantization.h"
+#include "network.h"
+#include "stdint.h"
+#include "torch/script.h"
+#include "torch/torch.h"
+#include "tuple"
+#include "utility"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+PolicyRunner::PolicyRunner(PolicyNetwork& policy, int64_t num_agents)
+    : policy_(&policy), quantized_policy_(nullptr), current_hidden_(0) {
+  torch::OrderedDict<std::string, torch::Tensor> gru_parameters =
+      policy_->rnn->named_parameters();
+  gru_weight_ih_ = gru_parameters["weight_ih_l0"];
+  gru_weight_hh_ = gru_parameters["weight_hh_l0"];
+  gru_bias_ih_ = gru_parameters["bias_ih_l0"];
+  gru_bias_hh_ = gru_parameters["bias_hh_l0"];
+
+  Allocate(num_agents);
+}
+
+PolicyRunner::PolicyRunner(torch::jit::Module exported_policy,
+                           int64_t num_agents)
+    : policy_(nullptr), exported_policy_(std::move(exported_policy)),
+      quantized_policy_(nullptr), current_hidden_(0) {
+  Allocate(num_agents);
+}
+
+PolicyRunner::PolicyRunner(const DynamicQuantizedPolicy& kQuantizedPolicy,
+                           int64_t num_agents)
+    : policy_(nullptr), quantized_policy_(&kQuantizedPolicy),
+      current_hidden_(0) {
+  Allocate(num_agents);
+}
+
+void PolicyRunner::Allocate(int64_t num_agents) {
+  /* Allocated as inference tensors, which have no version counter nor
+   * autograd metadata */
+  c10::InferenceMode inference_mode;
+
+  input_ = torch::empty({num_agents, num_local_states});
+  layer1_output_ = torch::empty({num_agents, hidden_size});
+  layer2_output_ = torch::empty({num_agents, hidden_size});
+  input_gates_ = torch::empty({num_agents, 3 * hidden_size});
+  hidden_gates_ = torch::empty({num_agents, 3 * hidden_size});
+  hidden_states_[0] = torch::zeros({num_agents, hidden_size});
+  hidden_states_[1] = torch::zeros({num_agents, hidden_size});
+  logits_ = torch::empty({num_agents, num_actions});
+  log_probabilities_ = torch::empty({num_agents, num_actions});
+  probabilities_ = torch::empty({num_agents, num_actions});
+  actions_ = torch::empty({num_agents}, torch::kLong);
+  action_log_probabilities_ = torch::empty({num_agents});
+
+  /* Views of the gates, taken once */
+  reset_update_gates_ = input_gates_.narrow(1, 0, 2 * hidden_size);
+  hidden_reset_update_gates_ = hidden_gates_.narrow(1, 0, 2 * hidden_size);
+  reset_gate_ = input_gates_.narrow(1, 0, hidden_size);
+  update_gate_ = input_gates_.narrow(1, hidden_size, hidden_size);
+  new_gate_ = input_gates_.narrow(1, 2 * hidden_size, hidden_size);
+  hidden_new_gate_ = hidden_gates_.narrow(1, 2 * hidden_size, hidden_size);
+}
+
+void PolicyRunner::Reset() {
+  c10::InferenceMode inference_mode;
+
+  hidden_states_[0].zero_();
+  hidden_states_[1].zero_();
+  current_hidden_ = 0;
+}
+
+std::tuple<torch::Tensor, torch::Tensor>
+PolicyRunner::Act(const torch::Tensor& kLocalStates) {
+  c10::InferenceMode inference_mode;
+
+  const torch::Tensor& kHiddenIn = hidden_states_[current_hidden_];
+  torch::Tensor& hidden_out = hidden_states_[1 - current_hidden_];
+
+  input_.copy_(kLocalStates.reshape(input_.sizes()));
+
+  if (exported_policy_) {
+    ForwardExported(kHiddenIn, hidden_out);
+  } else if (quantized_policy_ != nullptr) {
+    ForwardQuantized(kHiddenIn, hidden_out);
+  } else {
+    ForwardNetwork(kHiddenIn, hidden_out);
+  }
+
+  /* The most probable action of every agent */
+  torch::exp_out(probabilities_, log_probabilities_);
+  torch::max_out(action_log_probabilities_, actions_, log_probabilities_, 1);
+
+  current_hidden_ = 1 - current_hidden_;
+
+  return std::make_tuple(actions_, action_log_probabilities_);
+}
+
+void PolicyRunner::ForwardNetwork(const torch::Tensor& kHiddenIn,
+                                  torch::Tensor& hidden_out) {
+  /* The two input layers, tanh(x W^T + b) */
+  torch::addmm_out(layer1_output_, policy_->layer1->bias, input_,
+                   policy_->layer1->weight.t());
+  layer1_output_.tanh_();
+  torch::addmm_out(layer2_output_, policy_->layer2->bias, layer1_output_,
+                   policy_->layer2->weight.t());
+  layer2_output_.tanh_();
+
+  /* One GRU step, with the gates in the order of torch::nn::GRU:
+   * r = sigmoid(W_ir x + b_ir + W_hr h + b_hr)
+   * z = sigmoid(W_iz x + b_iz + W_hz h + b_hz)
+   * n = tanh(W_in x + b_in + r * (W_hn h + b_hn))
+   * h' = n + z * (h - n) */
+  torch::addmm_out(input_gates_, gru_bias_ih_, layer2_output_,
+                   gru_weight_ih_.t());
+  torch::addmm_out(hidden_gates_, gru_bias_hh_, kHiddenIn,
+                   gru_weight_hh_.t());
+
+  reset_update_gates_.add_(hidden_reset_update_gates_).sigmoid_();
+  new_gate_.addcmul_(hidden_new_gate_, reset_gate_).tanh_();
+
+  torch::sub_out(hidden_out, kHiddenIn, new_gate_);
+  hidden_out.mul_(update_gate_).add_(new_gate_);
+
+  /* Output layer. The out variant of log_softmax, in float without
+   * conversion */
+  torch::addmm_out(logits_, policy_->output_layer->bias, hidden_out,
+                   policy_->output_layer->weight.t());
+  torch::_log_softmax_out(log_probabilities_, logits_, 1, false);
+}
+
+void PolicyRunner::ForwardExported(const torch::Tensor& kHiddenIn,
+                                   torch::Tensor& hidden_out) {
+  /* The graph allocates its own outputs, which are copied into the buffers
+   * so the results stay valid in the same way as with a PolicyNetwork */
+  c10::ivalue::TupleElements outputs =
+      exported_policy_->forward({input_, kHiddenIn}).toTupleRef().elements();
+
+  log_probabilities_.copy_(outputs[0].toTensor());
+  hidden_out.copy_(outputs[1].toTensor());
+}
+
+void PolicyRunner::ForwardQuantized(const torch::Tensor& kHiddenIn,
+                                    torch::Tensor& hidden_out) {
+  std::tuple<torch::Tensor, torch::Tensor> policy_value =
+      quantized_policy_->Forward(input_, kHiddenIn);
+
+  torch::_log_softmax_out(log_probabilities_, std::get<0>(policy_value), 1,
+                          false);
+  hidden_out.copy_(std::get<1>(policy_value));
+}
+
+const torch::Tensor& PolicyRunner::GetProbabilities() const {
+  return probabilities_;
+}
+
+const torch::Tensor& PolicyRunner::GetInputHiddenStates() const {
+  return hidden_states_[1 - current_hidden_];
+}
+
+const torch::Tensor& PolicyRunner::GetHiddenStates() const {
+  return hidden_states_[current_hidden_];
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,239 @@
+/* policy_runner.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Action selection with the policy network, running in inference
+ * mode on tensors that are allocated once.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYRUNNER_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYRUNNER_H_
+
+#include "../../src/common_types.h"
+#include "dynamic_quantization.h"
+#include "network.h"
+#include "optional"
+#include "stdint.h"
+#include "torch/script.h"
+#include "torch/torch.h"
+#include "tuple"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief Class that selects the actions of a fixed number of agents with the
+ * policy network, one time step at a time.
+ *
+ * Gives the same results as PolicyNetwork::Forward followed by a softmax and
+ * an argmax, but runs under c10::InferenceMode and writes every intermediate
+ * result into tensors that are allocated in the constructor, so a time step
+ * allocates no tensors. The recurrent hidden states of the agents are kept
+ * between calls to Act().
+ *
+ * The parameters of the policy are read at every call, so updates to the
+ * policy are used from the next call on.
+ *
+ * It can instead run a policy exported with ExportPolicy, whose graph the
+ * TorchScript runtime has frozen and optimized, or a DynamicQuantizedPolicy.
+ *
+ * @note Not copyable, not moveable. The policy must outlive the runner.
+ */
+class PolicyRunner
+{
+ public:
+  /*!
+   * @brief Constructor that allocates the tensors and resets the hidden
+   * states.
+   *
+   * @param[in] policy The policy network used by all agents.
+   *
+   * @param[in] num_agents Number of agents that act in every time step.
+   */
+  PolicyRunner(PolicyNetwork& policy, int64_t num_agents);
+
+  /*!
+   * @brief Constructor that runs an exported policy instead of a
+   * PolicyNetwork.
+   *
+   * @param[in] exported_policy A policy exported with ExportPolicy or loaded
+   * with LoadExportedPolicy.
+   *
+   * @param[in] num_agents Number of agents that act in every time step.
+   */
+  PolicyRunner(torch::jit::Module exported_policy, int64_t num_agents);
+
+  /*!
+   * @brief Constructor that runs a policy with int8 weights instead of a
+   * PolicyNetwork.
+   *
+   * @param[in] kQuantizedPolicy The quantized policy, which must outlive the
+   * runner.
+   *
+   * @param[in] num_agents Number of agents that act in every time step.
+   */
+  PolicyRunner(const DynamicQuantizedPolicy& kQuantizedPolicy,
+               int64_t num_agents);
+
+  PolicyRunner(const PolicyRunner&) = delete;
+  PolicyRunner& operator=(const PolicyRunner&) = delete;
+
+  /*!
+   * @brief Sets the hidden states of all agents to zero, as at the start of
+   * an episode.
+   */
+  void Reset();
+
+  /*!
+   * @brief Selects the action with the highest probability for every agent
+   * and advances the hidden states by one time step.
+   *
+   * @param[in] kLocalStates The local states of all agents, with
+   * num_agents * num_local_states elements.
+   *
+   * @returns A tuple with the values (Indices of the chosen actions, with the
+   * shape [num_agents], log-probabilities of the chosen actions, with the
+   * shape [num_agents]). Both are only valid until the next call.
+   */
+  std::tuple<torch::Tensor, torch::Tensor>
+  Act(const torch::Tensor& kLocalStates);
+
+  /*!
+   * @brief Returns the probabilities of all actions in the last time step,
+   * with the shape [num_agents, num_actions]. Only valid until the next call
+   * to Act().
+   */
+  const torch::Tensor& GetProbabilities() const;
+
+  /*!
+   * @brief Returns the hidden states that were fed into the policy in the
+   * last time step, with the shape [num_agents, hidden_size]. Only valid
+   * until the next call to Act().
+   */
+  const torch::Tensor& GetInputHiddenStates() const;
+
+  /*!
+   * @brief Returns the hidden states that will be fed into the policy in the
+   * next time step, with the shape [num_agents, hidden_size].
+   */
+  const torch::Tensor& GetHiddenStates() const;
+
+ protected:
+  /*!
+   * @brief Allocates the tensors of num_agents agents.
+   */
+  void Allocate(int64_t num_agents);
+
+  /*!
+   * @brief Runs the layers of policy_ into logits_ and the hidden state
+   * buffer hidden_out.
+   */
+  void ForwardNetwork(const torch::Tensor& kHiddenIn,
+                      torch::Tensor& hidden_out);
+
+  /*!
+   * @brief Runs exported_policy_ into log_probabilities_ and the hidden state
+   * buffer hidden_out.
+   */
+  void ForwardExported(const torch::Tensor& kHiddenIn,
+                       torch::Tensor& hidden_out);
+
+  /*!
+   * @brief Runs quantized_policy_ into log_probabilities_ and the hidden
+   * state buffer hidden_out.
+   */
+  void ForwardQuantized(const torch::Tensor& kHiddenIn,
+                        torch::Tensor& hidden_out);
+
+  /*!
+   * @brief The policy network used by all agents, or nullptr when running an
+   * exported policy.
+   */
+  PolicyNetwork* policy_;
+
+  /*!
+   * @brief The exported policy used by all agents, if any.
+   */
+  std::optional<torch::jit::Module> exported_policy_;
+
+  /*!
+   * @brief The quantized policy used by all agents, or nullptr.
+   */
+  const DynamicQuantizedPolicy* quantized_policy_;
+
+  /*!
+   * @brief Weights and biases of the GRU of the policy.
+   */
+  torch::Tensor gru_weight_ih_;
+  torch::Tensor gru_weight_hh_;
+  torch::Tensor gru_bias_ih_;
+  torch::Tensor gru_bias_hh_;
+
+  /*!
+   * @brief Input of the policy, [num_agents, num_local_states].
+   */
+  torch::Tensor input_;
+
+  /*!
+   * @brief Outputs of the two input layers, [num_agents, hidden_size].
+   */
+  torch::Tensor layer1_output_;
+  torch::Tensor layer2_output_;
+
+  /*!
+   * @brief Input and hidden gate pre-activations of the GRU, [num_agents,
+   * 3 * hidden_size], in the order reset, update, new.
+   */
+  torch::Tensor input_gates_;
+  torch::Tensor hidden_gates_;
+
+  /*!
+   * @brief Views of the reset and update gates together, and of each gate,
+   * in input_gates_ and hidden_gates_.
+   */
+  torch::Tensor reset_update_gates_;
+  torch::Tensor hidden_reset_update_gates_;
+  torch::Tensor reset_gate_;
+  torch::Tensor update_gate_;
+  torch::Tensor new_gate_;
+  torch::Tensor hidden_new_gate_;
+
+  /*!
+   * @brief Two hidden state buffers, [num_agents, hidden_size], that swap
+   * between input and output every time step.
+   */
+  torch::Tensor hidden_states_[2];
+
+  /*!
+   * @brief Index of the hidden state buffer fed into the next time step.
+   */
+  int current_hidden_;
+
+  /*!
+   * @brief Output of the policy, [num_agents, num_actions].
+   */
+  torch::Tensor logits_;
+
+  /*!
+   * @brief Log-probabilities and probabilities of all actions, [num_agents,
+   * num_actions].
+   */
+  torch::Tensor log_probabilities_;
+  torch::Tensor probabilities_;
+
+  /*!
+   * @brief Chosen actions and their log-probabilities, [num_agents].
+   */
+  torch::Tensor actions_;
+  torch::Tensor action_log_probabilities_;
+};
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_POLICYRUNNER_H_ */
@@ -0,0 +1,210 @@
+/* rollout_storage.cc
+ * ==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Preallocated storage of the data collected by MappoRun and
+ * trained on by MappoUpdate.
+ * License: See LICENSE file for license details.
+ * ==============================================================================
+ */
+
+#include "rollout_storage.h"
+#include "../../src/common_types.h"
+#include "stdint.h"
+#include "torch/torch.h"
+#include "utils.h"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Returns time steps [start, start + length) of an episode as a view. */
+static torch::Tensor SliceEpisode(const torch::Tensor& kTensor, int64_t episode,
+                                  int64_t start, int64_t length) {
+  return kTensor.select(0, episode).slice(0, start, start + length);
+}
+
+/* Reshapes [num_episodes, num_time_steps, ...] into [num_chunks, chunk_length,
+ * ...] and selects the chunks with the given indices. */
+static torch::Tensor GatherChunks(const torch::Tensor& kTensor,
+                                  const torch::Tensor& kIndices,
+                                  int64_t chunks_per_episode,
+                                  int64_t chunk_length) {
+  std::vector<int64_t> shape = kTensor.sizes().vec();
+  int64_t num_episodes = shape[0];
+  shape.erase(shape.begin(), shape.begin() + 2);
+  shape.insert(shape.begin(), {num_episodes * chunks_per_episode,
+                               chunk_length});
+
+  return kTensor.slice(1, 0, chunks_per_episode * chunk_length)
+      .reshape(shape)
+      .index_select(0, kIndices);
+}
+
+/* Views [num_episodes, num_time_steps, ...] as [num_episodes * num_time_steps,
+ * ...], sharing the storage. */
+static torch::Tensor FlattenTimeSteps(const torch::Tensor& kTensor) {
+  return kTensor.flatten(0, 1);
+}
+
+RolloutStorage::RolloutStorage(int64_t num_episodes, int64_t num_time_steps,
+                               int64_t chunk_length)
+    : num_episodes_(num_episodes), num_time_steps_(num_time_steps),
+      chunk_length_(chunk_length),
+      chunks_per_episode_(num_time_steps / chunk_length) {
+  data_.states =
+      torch::zeros({num_episodes, num_time_steps, num_global_states});
+  data_.actions = torch::zeros(
+      {num_episodes, num_time_steps, amount_of_players_in_team}, torch::kLong);
+  data_.action_probabilities = torch::zeros(
+      {num_episodes, num_time_steps, amount_of_players_in_team, num_actions});
+  data_.log_probabilities =
+      torch::zeros({num_episodes, num_time_steps, amount_of_players_in_team});
+  data_.values = torch::zeros({num_episodes, num_time_steps});
+  data_.rewards =
+      torch::zeros({num_episodes, num_time_steps, amount_of_players_in_team});
+  data_.policy_hidden_states = torch::zeros(
+      {num_episodes, num_time_steps, amount_of_players_in_team, hidden_size});
+  data_.critic_hidden_states =
+      torch::zeros({num_episodes, num_time_steps, hidden_size});
+  data_.advantages =
+      torch::zeros({num_episodes, num_time_steps, amount_of_players_in_team});
+  data_.reward_to_go =
+      torch::zeros({num_episodes, num_time_steps, amount_of_players_in_team});
+
+  /* The fields written by Insert(), viewed once so that writing a time step
+   * only creates one view per field */
+  time_steps_.states = FlattenTimeSteps(data_.states);
+  time_steps_.actions = FlattenTimeSteps(data_.actions);
+  time_steps_.action_probabilities =
+      FlattenTimeSteps(data_.action_probabilities);
+  time_steps_.log_probabilities = FlattenTimeSteps(data_.log_probabilities);
+  time_steps_.values = FlattenTimeSteps(data_.values);
+  time_steps_.rewards = FlattenTimeSteps(data_.rewards);
+  time_steps_.policy_hidden_states =
+      FlattenTimeSteps(data_.policy_hidden_states);
+  time_steps_.critic_hidden_states =
+      FlattenTimeSteps(data_.critic_hidden_states);
+}
+
+void RolloutStorage::Insert(int64_t episode, int64_t time_step,
+                            const torch::Tensor& kState,
+                            const torch::Tensor& kActions,
+                            const torch::Tensor& kActionProbabilities,
+                            const torch::Tensor& kLogProbabilities,
+                            const torch::Tensor& kValue,
+                            const torch::Tensor& kRewards,
+                            const torch::Tensor& kPolicyHiddenStates,
+                            const torch::Tensor& kCriticHiddenState) {
+  int64_t index = episode * num_time_steps_ + time_step;
+
+  /* Write the time step in place, so no new storage is allocated. */
+  time_steps_.states.select(0, index).copy_(
+      kState.reshape({num_global_states}));
+  time_steps_.actions.select(0, index).copy_(
+      kActions.reshape({amount_of_players_in_team}));
+  time_steps_.action_probabilities.select(0, index).copy_(
+      kActionProbabilities);
+  time_steps_.log_probabilities.select(0, index).copy_(
+      kLogProbabilities.reshape({amount_of_players_in_team}));
+  time_steps_.values.select(0, index).copy_(kValue.reshape({}));
+  time_steps_.rewards.select(0, index).copy_(kRewards);
+  time_steps_.policy_hidden_states.select(0, index).copy_(
+      kPolicyHiddenStates.reshape({amount_of_players_in_team, hidden_size}));
+  time_steps_.critic_hidden_states.select(0, index).copy_(
+      kCriticHiddenState.reshape({hidden_size}));
+}
+
+void RolloutStorage::ComputeReturns(int64_t episode, double discount,
+                                    double gae_parameter) {
+  /* The functions in utils.h take the rewards as [num_agents,
+   * num_time_steps]. */
+  torch::Tensor rewards = data_.rewards[episode].t();
+
+  torch::Tensor reward_to_go = ComputeRewardToGo(rewards, discount);
+  torch::Tensor temporal_difference =
+      ComputeTemporalDifference(data_.values[episode], rewards, discount);
+  torch::Tensor gae = ComputeGeneralAdvantageEstimation(temporal_difference,
+                                                        discount, gae_parameter);
+
+  data_.reward_to_go[episode].copy_(reward_to_go.t());
+  data_.advantages[episode].copy_(gae.t());
+}
+
+RolloutChunk RolloutStorage::GetChunk(int64_t index) const {
+  int64_t episode = index / chunks_per_episode_;
+  int64_t start = (index % chunks_per_episode_) * chunk_length_;
+
+  RolloutChunk chunk;
+  chunk.states = SliceEpisode(data_.states, episode, start, chunk_length_);
+  chunk.actions = SliceEpisode(data_.actions, episode, start, chunk_length_);
+  chunk.action_probabilities =
+      SliceEpisode(data_.action_probabilities, episode, start, chunk_length_);
+  chunk.log_probabilities =
+      SliceEpisode(data_.log_probabilities, episode, start, chunk_length_);
+  chunk.values = SliceEpisode(data_.values, episode, start, chunk_length_);
+  chunk.rewards = SliceEpisode(data_.rewards, episode, start, chunk_length_);
+  chunk.policy_hidden_states =
+      SliceEpisode(data_.policy_hidden_states, episode, start, chunk_length_);
+  chunk.critic_hidden_states =
+      SliceEpisode(data_.critic_hidden_states, episode, start, chunk_length_);
+  chunk.advantages =
+      SliceEpisode(data_.advantages, episode, start, chunk_length_);
+  chunk.reward_to_go =
+      SliceEpisode(data_.reward_to_go, episode, start, chunk_length_);
+
+  return chunk;
+}
+
+RolloutChunk RolloutStorage::GetChunks(const torch::Tensor& kIndices) const {
+  torch::Tensor indices = kIndices.to(torch::kLong);
+
+  RolloutChunk chunks;
+  chunks.states = GatherChunks(data_.states, indices, chunks_per_episode_,
+                               chunk_length_);
+  chunks.actions = GatherChunks(data_.actions, indices, chunks_per_episode_,
+                                chunk_length_);
+  chunks.action_probabilities =
+      GatherChunks(data_.action_probabilities, indices, chunks_per_episode_,
+                   chunk_length_);
+  chunks.log_probabilities = GatherChunks(
+      data_.log_probabilities, indices, chunks_per_episode_, chunk_length_);
+  chunks.values = GatherChunks(data_.values, indices, chunks_per_episode_,
+                               chunk_length_);
+  chunks.rewards = GatherChunks(data_.rewards, indices, chunks_per_episode_,
+                                chunk_length_);
+  chunks.policy_hidden_states = GatherChunks(
+      data_.policy_hidden_states, indices, chunks_per_episode_, chunk_length_);
+  chunks.critic_hidden_states = GatherChunks(
+      data_.critic_hidden_states, indices, chunks_per_episode_, chunk_length_);
+  chunks.advantages = GatherChunks(data_.advantages, indices,
+                                   chunks_per_episode_, chunk_length_);
+  chunks.reward_to_go = GatherChunks(data_.reward_to_go, indices,
+                                     chunks_per_episode_, chunk_length_);
+
+  return chunks;
+}
+
+int64_t RolloutStorage::NumChunks() const {
+  return num_episodes_ * chunks_per_episode_;
+}
+
+int64_t RolloutStorage::NumEpisodes() const { return num_episodes_; }
+
+int64_t RolloutStorage::NumTimeSteps() const { return num_time_steps_; }
+
+int64_t RolloutStorage::ChunkLength() const { return chunk_length_; }
+
+const torch::Tensor& RolloutStorage::GetStates() const {
+  return data_.states;
+}
+
+const torch::Tensor& RolloutStorage::GetRewards() const {
+  return data_.rewards;
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,242 @@
+/* rollout_storage.h
+ * ==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Preallocated storage of the data collected by MappoRun and
+ * trained on by MappoUpdate.
+ * License: See LICENSE file for license details.
+ * ==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_ROLLOUTSTORAGE_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_ROLLOUTSTORAGE_H_
+
+#include "../../src/common_types.h"
+#include "stdint.h"
+#include "torch/torch.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief Struct representing one or more chunks of consecutive time steps in
+ * the rollout storage.
+ *
+ * The tensors have the leading dimensions [chunk_length] for a single chunk,
+ * or [num_chunks, chunk_length] for a set of chunks, followed by the dimensions
+ * listed for each member.
+ *
+ * @note Referred to as "D" in the paper, "The Surprising Effectiveness of PPO
+ * in Cooperative Multi-Agent Games" - https://arxiv.org/pdf/2103.01955
+ */
+struct RolloutChunk {
+  /*!
+   * @brief Global states, [num_global_states].
+   */
+  torch::Tensor states;
+
+  /*!
+   * @brief Indices of the chosen actions, [amount_of_players_in_team].
+   */
+  torch::Tensor actions;
+
+  /*!
+   * @brief Probabilities of all actions, [amount_of_players_in_team,
+   * num_actions].
+   */
+  torch::Tensor action_probabilities;
+
+  /*!
+   * @brief Log-probabilities of the chosen actions,
+   * [amount_of_players_in_team].
+   */
+  torch::Tensor log_probabilities;
+
+  /*!
+   * @brief Critic value estimates, no trailing dimensions.
+   */
+  torch::Tensor values;
+
+  /*!
+   * @brief Rewards, [amount_of_players_in_team].
+   */
+  torch::Tensor rewards;
+
+  /*!
+   * @brief Policy hidden states fed into the policy network at the time step,
+   * [amount_of_players_in_team, hidden_size].
+   */
+  torch::Tensor policy_hidden_states;
+
+  /*!
+   * @brief Critic hidden state fed into the critic network at the time step,
+   * [hidden_size].
+   */
+  torch::Tensor critic_hidden_states;
+
+  /*!
+   * @brief General advantage estimation, [amount_of_players_in_team].
+   */
+  torch::Tensor advantages;
+
+  /*!
+   * @brief Discounted reward-to-go, [amount_of_players_in_team].
+   */
+  torch::Tensor reward_to_go;
+};
+
+/*!
+ * @brief Class that stores everything collected during a run in contiguous
+ * tensors that are allocated once.
+ *
+ * Each tensor has the leading dimensions [num_episodes, num_time_steps]. Time
+ * steps are written in place with Insert(), and chunks are read back as views
+ * with GetChunk() or gathered into a mini batch with GetChunks().
+ *
+ * @note Copyable, moveable. Copies share the underlying tensors.
+ */
+class RolloutStorage
+{
+ public:
+  /*!
+   * @brief Constructor that allocates the storage.
+   *
+   * @param[in] num_episodes Number of episodes that will be collected.
+   *
+   * @param[in] num_time_steps Number of time steps in each episode.
+   *
+   * @param[in] chunk_length Number of time steps in each chunk. Time steps at
+   * the end of an episode that do not fill a whole chunk are not part of any
+   * chunk.
+   */
+  RolloutStorage(int64_t num_episodes, int64_t num_time_steps,
+                 int64_t chunk_length);
+
+  /*!
+   * @brief Writes the data of one time step into the storage.
+   *
+   * @param[in] episode Index of the episode.
+   * @param[in] time_step Index of the time step within the episode.
+   * @param[in] kState Global state, with num_global_states elements.
+   * @param[in] kActions Chosen action of every agent, with the shape
+   * [amount_of_players_in_team].
+   * @param[in] kActionProbabilities Probabilities of all actions, with the
+   * shape [amount_of_players_in_team, num_actions].
+   * @param[in] kLogProbabilities Log-probabilities of the chosen actions, with
+   * amount_of_players_in_team elements.
+   * @param[in] kValue Critic value estimate, with one element.
+   * @param[in] kRewards Reward of every agent, with the shape
+   * [amount_of_players_in_team].
+   * @param[in] kPolicyHiddenStates Hidden states that were fed into the policy
+   * network, with amount_of_players_in_team * hidden_size elements.
+   * @param[in] kCriticHiddenState Hidden state that was fed into the critic
+   * network, with hidden_size elements.
+   */
+  void Insert(int64_t episode, int64_t time_step, const torch::Tensor& kState,
+              const torch::Tensor& kActions,
+              const torch::Tensor& kActionProbabilities,
+              const torch::Tensor& kLogProbabilities,
+              const torch::Tensor& kValue, const torch::Tensor& kRewards,
+              const torch::Tensor& kPolicyHiddenStates,
+              const torch::Tensor& kCriticHiddenState);
+
+  /*!
+   * @brief Computes the reward-to-go and general advantage estimation of a
+   * completed episode.
+   *
+   * @param[in] episode Index of the episode.
+   * @param[in] discount Discount factor.
+   * @param[in] gae_parameter GAE parameter.
+   */
+  void ComputeReturns(int64_t episode, double discount, double gae_parameter);
+
+  /*!
+   * @brief Returns a chunk as views into the storage, without copying.
+   *
+   * @param[in] index Index of the chunk, in the range [0, NumChunks()).
+   */
+  RolloutChunk GetChunk(int64_t index) const;
+
+  /*!
+   * @brief Gathers a set of chunks into a mini batch.
+   *
+   * @param[in] kIndices Indices of the chunks, with the shape [num_chunks].
+   *
+   * @returns The chunks with the leading dimensions [num_chunks,
+   * chunk_length].
+   */
+  RolloutChunk GetChunks(const torch::Tensor& kIndices) const;
+
+  /*!
+   * @brief Returns the total number of chunks over all episodes.
+   */
+  int64_t NumChunks() const;
+
+  /*!
+   * @brief Returns the number of episodes.
+   */
+  int64_t NumEpisodes() const;
+
+  /*!
+   * @brief Returns the number of time steps in each episode.
+   */
+  int64_t NumTimeSteps() const;
+
+  /*!
+   * @brief Returns the number of time steps in each chunk.
+   */
+  int64_t ChunkLength() const;
+
+  /*!
+   * @brief Returns the global states of all episodes, with the shape
+   * [num_episodes, num_time_steps, num_global_states].
+   */
+  const torch::Tensor& GetStates() const;
+
+  /*!
+   * @brief Returns the rewards of all episodes, with the shape [num_episodes,
+   * num_time_steps, amount_of_players_in_team].
+   */
+  const torch::Tensor& GetRewards() const;
+
+ protected:
+  /*!
+   * @brief Number of episodes.
+   */
+  int64_t num_episodes_;
+
+  /*!
+   * @brief Number of time steps in each episode.
+   */
+  int64_t num_time_steps_;
+
+  /*!
+   * @brief Number of time steps in each chunk.
+   */
+  int64_t chunk_length_;
+
+  /*!
+   * @brief Number of whole chunks in each episode.
+   */
+  int64_t chunks_per_episode_;
+
+  /*!
+   * @brief All stored data, laid out as described in RolloutChunk with the
+   * leading dimensions [num_episodes, num_time_steps].
+   */
+  RolloutChunk data_;
+
+  /*!
+   * @brief Views of the fields of data_ that Insert() writes, with the
+   * leading dimension [num_episodes * num_time_steps].
+   */
+  RolloutChunk time_steps_;
+};
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_ROLLOUTSTORAGE_H_ */
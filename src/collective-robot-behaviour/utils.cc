@@ -8,6 +8,7 @@
  */
 
 #include "utils.h"
+#include "algorithm"
 #include "cmath"
 #include "iostream"
 #include "stdint.h"
@@ -21,20 +22,41 @@ namespace collective_robot_behaviour
 
 torch::Tensor ComputeRewardToGo(const torch::Tensor& kRewards,
                                 double discount) {
-  int32_t num_time_steps = kRewards.size(0);
+  int64_t num_time_steps = kRewards.size(-1);
 
-  /* Calculate the finite-horizon undiscounted reward-to-go. */
-  torch::Tensor output = torch::zeros(num_time_steps);
+  /* Work on a contiguous float copy where every row is one trajectory. */
+  torch::Tensor output =
+      kRewards.detach().to(torch::kCPU, torch::kFloat).contiguous().clone();
+  int64_t num_rows = output.numel() / std::max<int64_t>(num_time_steps, 1);
+  float* data = output.data_ptr<float>();
 
-  output[num_time_steps - 1] =
-      pow(discount, num_time_steps - 1) * kRewards[num_time_steps - 1];
-  for (int32_t t = num_time_steps - 2; t >= 0; t--) {
-    output[t] = pow(discount, t) * kRewards[t] + output[t + 1];
+  for (int64_t row = 0; row < num_rows; row++) {
+    float* row_data = data + row * num_time_steps;
+    ComputeRewardToGo(row_data, row_data, num_time_steps, discount);
   }
 
   return output;
 }
 
+void ComputeRewardToGo(const float* kRewards, float* reward_to_go,
+                       int64_t num_time_steps, double discount) {
+  /* Discount every reward by discount^t, with the power carried forward
+   * instead of recomputed for every time step. */
+  double discount_power = 1.0;
+  for (int64_t t = 0; t < num_time_steps; t++) {
+    reward_to_go[t] = static_cast<float>(discount_power * kRewards[t]);
+    discount_power *= discount;
+  }
+
+  /* Sum the discounted rewards from the end, accumulating in double
+   * precision. */
+  double accumulated = 0.0;
+  for (int64_t t = num_time_steps - 1; t >= 0; t--) {
+    accumulated += reward_to_go[t];
+    reward_to_go[t] = static_cast<float>(accumulated);
+  }
+}
+
 torch::Tensor NormalizeRewardToGo(const torch::Tensor& kRewardToGo) {
 
   torch::Tensor output = kRewardToGo.clone();
@@ -54,47 +76,55 @@ torch::Tensor NormalizeRewardToGo(const torch::Tensor& kRewardToGo) {
 torch::Tensor ComputeTemporalDifference(const torch::Tensor& kCriticValues,
                                         const torch::Tensor& kRewards,
                                         double discount) {
-  int32_t num_agents = kRewards.size(0);
-  int32_t num_time_steps = kRewards.size(1);
-
-  /* Calculate the temporal differences from t=0 up to t=T-2 */
-  torch::Tensor temporal_difference =
-      torch::zeros({num_agents, num_time_steps});
-  for (int32_t j = 0; j < num_agents; j++) {
-    for (int32_t t = 0; t < num_time_steps - 1; t++) {
-      temporal_difference[j][t] =
-          kRewards[j][t] + discount * kCriticValues[t + 1] - kCriticValues[t];
-    }
-
-    /* Handle the last time step (without discounting future value). */
-    temporal_difference[j][num_time_steps - 1] =
-        kRewards[j][num_time_steps - 1] - kCriticValues[num_time_steps - 1];
-  }
+  int64_t num_time_steps = kRewards.size(1);
+
+  /* The value after the last time step is not discounted into the last
+   * temporal difference, so it is padded with zero. */
+  torch::Tensor next_critic_values = torch::zeros_like(kCriticValues);
+  next_critic_values.slice(0, 0, num_time_steps - 1) =
+      kCriticValues.slice(0, 1, num_time_steps);
 
-  return temporal_difference;
+  /* Calculate the temporal differences for all agents at once by broadcasting
+   * the critic values over the agent dimension. */
+  return kRewards + discount * next_critic_values - kCriticValues;
 }
 
 torch::Tensor
 ComputeGeneralAdvantageEstimation(const torch::Tensor& kTemporalDifferences,
                                   double discount, double gae_parameter) {
-  int32_t num_agents = kTemporalDifferences.size(0);
-  int32_t num_time_steps = kTemporalDifferences.size(1);
-
-  /* Calculate the Generalized Advantage Estimation (GAE) for each time step and
-   * agent. */
-  torch::Tensor gae = torch::zeros({num_agents, num_time_steps});
-  for (int32_t j = 0; j < num_agents; j++) {
-    for (int32_t t = 0; t < num_time_steps; t++) {
-      for (int32_t m = 0; m <= num_time_steps - t - 1; m++) {
-        gae[j][t] +=
-            pow(discount * gae_parameter, m) * kTemporalDifferences[j][t + m];
-      }
-    }
+  int64_t num_agents = kTemporalDifferences.size(0);
+  int64_t num_time_steps = kTemporalDifferences.size(1);
+
+  /* Work on a contiguous float copy where every row is one agent. */
+  torch::Tensor gae = kTemporalDifferences.detach()
+                          .to(torch::kCPU, torch::kFloat)
+                          .contiguous()
+                          .clone();
+  float* data = gae.data_ptr<float>();
+
+  for (int64_t j = 0; j < num_agents; j++) {
+    float* row_data = data + j * num_time_steps;
+    ComputeGeneralAdvantageEstimation(row_data, row_data, num_time_steps,
+                                      discount, gae_parameter);
   }
 
   return gae;
 }
 
+void ComputeGeneralAdvantageEstimation(const float* kTemporalDifferences,
+                                       float* gae, int64_t num_time_steps,
+                                       double discount, double gae_parameter) {
+  /* Calculate the Generalized Advantage Estimation (GAE) with the backward
+   * recursion, which is equal to the sum of the exponentially weighted
+   * temporal differences but only needs a single pass. */
+  double decay = discount * gae_parameter;
+  double accumulated = 0.0;
+  for (int64_t t = num_time_steps - 1; t >= 0; t--) {
+    accumulated = kTemporalDifferences[t] + decay * accumulated;
+    gae[t] = static_cast<float>(accumulated);
+  }
+}
+
 torch::Tensor
 ComputeProbabilityRatio(const torch::Tensor& kCurrentProbabilities,
                         const torch::Tensor& kPreviousProbabilities) {
@@ -105,66 +135,54 @@ torch::Tensor
 ComputePolicyLoss(const torch::Tensor& kGeneralAdvantageEstimation,
                   const torch::Tensor& kProbabilityRatio, float clip_value,
                   const torch::Tensor& kPolicyEntropy) {
+  /* The mean runs over every chunk, agent and time step, so it is taken in
+   * float32 even if the ratios come from a lower precision network. */
+  torch::Tensor probability_ratio = kProbabilityRatio.to(torch::kFloat);
+  torch::Tensor advantages = kGeneralAdvantageEstimation.to(torch::kFloat);
 
   /* Clip the probability ratio. */
   torch::Tensor probability_ratio_clipped =
-      kProbabilityRatio.clamp(1 - clip_value, 1 + clip_value);
-
-  int32_t mini_batch_size = kGeneralAdvantageEstimation.size(0);
-  int32_t num_agents = kGeneralAdvantageEstimation.size(1);
-  int32_t num_time_steps = kGeneralAdvantageEstimation.size(2);
-
-  torch::Tensor loss = torch::zeros(1);
-
-  /* Calculate the policy loss. */
-  for (int32_t t = 0; t < num_time_steps; t++) {
-    for (int32_t j = 0; j < num_agents; j++) {
-      for (int32_t i = 0; i < mini_batch_size; i++) {
-        loss += torch::min(kProbabilityRatio[i][j][t] *
-                               kGeneralAdvantageEstimation[i][j][t],
-                           probability_ratio_clipped[i][j][t] *
-                               kGeneralAdvantageEstimation[i][j][t]);
-      }
-    }
-  }
+      probability_ratio.clamp(1 - clip_value, 1 + clip_value);
+
+  /* Calculate the clipped surrogate for every chunk, agent and time step at
+   * once and average it, so that the autograd graph only holds a handful of
+   * nodes regardless of the size of the mini batch. */
+  torch::Tensor surrogate =
+      torch::min(probability_ratio * advantages,
+                 probability_ratio_clipped * advantages);
 
-  return loss.div(mini_batch_size * num_agents * num_time_steps) +
-         kPolicyEntropy;
+  return surrogate.mean().reshape({1}) + kPolicyEntropy;
 }
 
 torch::Tensor ComputeCriticLoss(const torch::Tensor& kCurrentValues,
                                 const torch::Tensor& kPreviousValues,
                                 const torch::Tensor& kRewardToGo,
                                 float clip_value) {
-  /* Get the shape of the tensors. */
-  int32_t num_mini_batches = kCurrentValues.size(0);
-  int32_t num_time_steps = kCurrentValues.size(1);
-  int32_t num_agents = kRewardToGo.size(1);
+  /* The losses and their mean are taken in float32, as in ComputePolicyLoss */
+  torch::Tensor current_values = kCurrentValues.to(torch::kFloat);
 
   /* Clip the current values. */
   torch::Tensor clipping_min = kPreviousValues - clip_value;
   torch::Tensor clipping_max = kPreviousValues + clip_value;
   torch::Tensor current_values_clipped =
-      torch::clamp(kCurrentValues, clipping_min, clipping_max);
+      torch::clamp(current_values, clipping_min, clipping_max);
 
-  torch::Tensor loss = torch::zeros(1);
+  /* The critic values are shared by all agents, so broadcast them from
+   * [mini_batch_size, num_time_steps] to the shape of the reward-to-go,
+   * [mini_batch_size, num_agents, num_time_steps]. */
+  current_values = current_values.unsqueeze(1).expand_as(kRewardToGo);
+  current_values_clipped =
+      current_values_clipped.unsqueeze(1).expand_as(kRewardToGo);
 
   /* Calculate the loss. */
-  for (int32_t i = 0; i < num_mini_batches; i++) {
-    for (int32_t j = 0; j < num_agents; j++) {
-      for (int32_t t = 0; t < num_time_steps; t++) {
-        torch::Tensor current_values_loss =
-            torch::huber_loss(kCurrentValues[i][t], kRewardToGo[i][j][t],
-                              at::Reduction::None, 10);
-        torch::Tensor current_values_clipped_loss =
-            torch::huber_loss(current_values_clipped[i][t],
-                              kRewardToGo[i][j][t], at::Reduction::None, 10);
-        loss += torch::max(current_values_loss, current_values_clipped_loss);
-      }
-    }
-  }
-
-  return loss.div(num_mini_batches * num_agents * num_time_steps);
+  torch::Tensor current_values_loss = torch::huber_loss(
+      current_values, kRewardToGo, at::Reduction::None, 10);
+  torch::Tensor current_values_clipped_loss = torch::huber_loss(
+      current_values_clipped, kRewardToGo, at::Reduction::None, 10);
+
+  return torch::max(current_values_loss, current_values_clipped_loss)
+      .mean()
+      .reshape({1});
 }
 
 torch::Tensor ComputePolicyEntropy(const torch::Tensor& kActionsProbabilities,
@@ -175,28 +193,12 @@ torch::Tensor ComputePolicyEntropy(const torch::Tensor& kActionsProbabilities,
   torch::Tensor clipped_probabilities =
       torch::clamp(kActionsProbabilities, 1e-10, 1.0);
 
-  int32_t num_mini_batch = kActionsProbabilities.size(0);
-  int32_t num_agents = kActionsProbabilities.size(1);
-  int32_t num_time_steps = kActionsProbabilities.size(2);
-  int32_t num_actions = kActionsProbabilities.size(3);
-
-  torch::Tensor entropy = torch::zeros(1);
-
-  /* Compute the entropy over all the time steps in the chunks for each agent.
-   */
-  for (int32_t i = 0; i < num_mini_batch; i++) {
-    for (int32_t k = 0; k < num_agents; k++) {
-      for (int32_t t = 0; t < num_time_steps; t++) {
-        torch::Tensor probabitilies = kActionsProbabilities[i][k][t];
-
-        entropy += -torch::sum(probabitilies.log2().mul(probabitilies));
-      }
-    }
-  }
+  /* Compute the entropy over the actions for every chunk, agent and time step
+   * and calculate the average entropy over them. */
+  torch::Tensor entropy =
+      -(kActionsProbabilities * clipped_probabilities.log2()).sum(-1);
 
-  /* Calculate the average entropy over the chunks. */
-  return entropy_coefficient *
-         entropy.div(num_mini_batch * num_agents * num_time_steps);
+  return entropy_coefficient * entropy.mean().reshape({1});
 }
 
 } /* namespace collective_robot_behaviour */
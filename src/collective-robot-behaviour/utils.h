@@ -23,14 +23,29 @@ namespace collective_robot_behaviour
 
 /*!
  * @brief Computes the reward-to-go for each time step.
- * @returns The reward-to-go values with the shape [num_time_steps, 1].
+ * @returns The reward-to-go values with the same shape as the rewards.
  * @param[in] rewards: The accumulated reward for each time step, with the shape
- * [num_time_steps, 1].
+ * [num_time_steps] or [num_agents, num_time_steps]. Each row is treated as an
+ * independent trajectory.
  *
  * @param[in] discount: Discount factor.
  */
 torch::Tensor ComputeRewardToGo(const torch::Tensor& kRewards, double discount);
 
+/*!
+ * @brief Computes the reward-to-go for one trajectory stored in a contiguous
+ * buffer, using one forward pass that discounts the rewards and one backward
+ * pass that sums them.
+ *
+ * @param[in] rewards: Pointer to num_time_steps rewards.
+ * @param[out] reward_to_go: Pointer to num_time_steps values that will hold the
+ * reward-to-go. May alias the rewards.
+ * @param[in] num_time_steps: Number of time steps in the trajectory.
+ * @param[in] discount: Discount factor.
+ */
+void ComputeRewardToGo(const float* kRewards, float* reward_to_go,
+                       int64_t num_time_steps, double discount);
+
 /*!
  * @brief Normalizes the reward-to-go values.
  * @returns The normalized reward-to-go values with the shape [num_time_steps,
@@ -76,6 +91,23 @@ torch::Tensor
 ComputeGeneralAdvantageEstimation(const torch::Tensor& kTemporalDifferences,
                                   double discount, double gae_parameter);
 
+/*!
+ * @brief Computes the general advantage estimation for one agent stored in a
+ * contiguous buffer, using the backward recursion
+ * gae[t] = delta[t] + discount * gae_parameter * gae[t + 1].
+ *
+ * @param[in] temporal_differences: Pointer to num_time_steps temporal
+ * differences.
+ * @param[out] gae: Pointer to num_time_steps values that will hold the general
+ * advantage estimation. May alias the temporal differences.
+ * @param[in] num_time_steps: Number of time steps in the trajectory.
+ * @param[in] discount: Discount factor.
+ * @param[in] gae_parameter: GAE parameter.
+ */
+void ComputeGeneralAdvantageEstimation(const float* kTemporalDifferences,
+                                       float* gae, int64_t num_time_steps,
+                                       double discount, double gae_parameter);
+
 /*!
  * @brief Computes the probability ratio for all agents for each time step.
  *
@@ -125,7 +157,7 @@ ComputePolicyLoss(const torch::Tensor& kGeneralAdvantageEstimation,
  * @brief Computes the critic loss over the specified number of chunks and time
  * steps.
  *
- * @returns The critic loss over a number of time steps.
+ * @returns The critic loss over a number of time steps, with the shape [1].
  *
  * @param[in] current_values: Values from the Critic network with current
  * parameters for each agent and chunk in the mini batch, with shape
@@ -149,7 +181,7 @@ torch::Tensor ComputeCriticLoss(const torch::Tensor& kCurrentValues,
  * @brief Computes the policy entropy over the specified number of chunks and
  * time steps.
  *
- * @returns The policy entropy.
+ * @returns The policy entropy, with the shape [1].
  *
  * @param[in] actions_probabilities: Probabilities of all the actions for each
  * agent and time step, with the shape [mini_batch_size, num_agents,
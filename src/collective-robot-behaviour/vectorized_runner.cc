@@ -0,0 +1,181 @@
+/* vectorized_runner.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Collects rollouts from several environments at once, with one
+ * policy forward pass for the agents of all environments per time step.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "vectorized_runner.h"
+#include "../../src/common_types.h"
+#include "communication.h"
+#include "dynamic_quantization.h"
+#include "network.h"
+#include "optional"
+#include "phase_timer.h"
+#include "policy_runner.h"
+#include "rollout_storage.h"
+#include "run_state.h"
+#include "stdint.h"
+#include "torch/torch.h"
+#include "tuple"
+#include "utility"
+#include "vector"
+#include "worker_pool.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+VectorizedRunner::VectorizedRunner(std::vector<Environment> environments,
+                                   Team own_team, int num_threads)
+    : environments_(std::move(environments)),
+      run_states_(environments_.size()), own_team_(own_team),
+      opponent_team_(ComputeOpponentTeam(own_team)),
+      worker_pool_(num_threads > 0 ? num_threads
+                                   : static_cast<int>(environments_.size())),
+      states_(torch::zeros({static_cast<int64_t>(environments_.size()),
+                            num_global_states})),
+      quantized_inference_(false) {}
+
+RolloutStorage VectorizedRunner::Run(PolicyNetwork& policy,
+                                     CriticNetwork& critic,
+                                     int64_t episodes_per_environment) {
+  torch::AutoGradMode enable_grad_mode(false);
+
+  int64_t num_environments = NumEnvironments();
+  int64_t num_agents = num_environments * amount_of_players_in_team;
+  RolloutStorage rollout(episodes_per_environment * num_environments,
+                         max_timesteps - 1, chunk_length);
+
+  /* The int8 copies are made from the weights of this rollout */
+  std::optional<DynamicQuantizedPolicy> quantized_policy;
+  std::optional<DynamicQuantizedCritic> quantized_critic;
+  std::optional<PolicyRunner> policy_runner_storage;
+  if (quantized_inference_) {
+    quantized_policy.emplace(policy);
+    quantized_critic.emplace(critic);
+    policy_runner_storage.emplace(*quantized_policy, num_agents);
+  } else {
+    policy_runner_storage.emplace(policy, num_agents);
+  }
+  PolicyRunner& policy_runner = *policy_runner_storage;
+
+  for (int64_t round = 0; round < episodes_per_environment; round++) {
+    int64_t first_episode = round * num_environments;
+
+    /* Reset the hidden states of all environments for timestep 0 */
+    policy_runner.Reset();
+    torch::Tensor critic_hidden_states =
+        torch::zeros({1, num_environments, hidden_size});
+
+    /* Read the state twice, since the first read after a reset can still
+     * return a vision frame from before it */
+    worker_pool_.ParallelFor(num_environments, [this](int64_t i) {
+      ReadState(i);
+      ReadState(i);
+    });
+
+    for (int64_t timestep = 0; timestep < rollout.NumTimeSteps(); timestep++) {
+      /* The workers overwrite states_ with the next states below */
+      torch::Tensor states = states_.clone();
+
+      /* One critic forward pass with every environment as the batch:
+       * [1, environments, states]. The reserved robot id is set to -1 as in
+       * MappoUpdate, so the recorded values are the ones it trains against.
+       * Then one policy step with every agent of every environment as the
+       * batch, which picks the actions with the highest probabilities */
+      std::tuple<torch::Tensor, torch::Tensor> critic_value;
+      torch::Tensor values;
+      {
+        CENTRALISEDAI_TIME_PHASE(Phase::kCriticForward);
+        torch::Tensor global_states = states.clone();
+        global_states.select(1, 0).fill_(-1);
+        if (quantized_critic) {
+          critic_value = quantized_critic->Forward(global_states,
+                                                   critic_hidden_states[0]);
+          std::get<1>(critic_value) = std::get<1>(critic_value).unsqueeze(0);
+        } else {
+          critic_value = critic.Forward(global_states.unsqueeze(0),
+                                        critic_hidden_states);
+        }
+        values = std::get<0>(critic_value).reshape({num_environments});
+      }
+
+      torch::Tensor actions;
+      torch::Tensor log_probabilities;
+      {
+        CENTRALISEDAI_TIME_PHASE(Phase::kPolicyForward);
+        auto [chosen_actions, chosen_log_probabilities] =
+            policy_runner.Act(ComputeLocalStates(states));
+        actions =
+            chosen_actions.view({num_environments, amount_of_players_in_team});
+        log_probabilities = chosen_log_probabilities.view(
+            {num_environments, amount_of_players_in_team});
+      }
+      torch::Tensor action_probabilities =
+          policy_runner.GetProbabilities().view(
+              {num_environments, amount_of_players_in_team, num_actions});
+      const torch::Tensor& kPolicyHiddenStates =
+          policy_runner.GetInputHiddenStates();
+
+      /* Step all environments, and store each time step into its own episode
+       * so the workers never write the same memory */
+      worker_pool_.ParallelFor(num_environments, [&](int64_t i) {
+        {
+          CENTRALISEDAI_TIME_PHASE(Phase::kSendActions);
+          SendActions(environments_[i].command_channel, actions[i]);
+        }
+        ReadState(i);
+
+        torch::Tensor rewards;
+        {
+          CENTRALISEDAI_TIME_PHASE(Phase::kRewards);
+          rewards = run_states_[i].ComputeRewards(states_[i],
+                                                  {-0.001, 500, 10, 0.001});
+        }
+
+        rollout.Insert(first_episode + i, timestep, states[i], actions[i],
+                       action_probabilities[i], log_probabilities[i],
+                       values[i], rewards,
+                       kPolicyHiddenStates.slice(
+                           0, i * amount_of_players_in_team,
+                           (i + 1) * amount_of_players_in_team),
+                       critic_hidden_states.select(1, i));
+      });
+
+      critic_hidden_states = std::get<1>(critic_value);
+    }
+
+    /* Calculate reward-to-go and general advantage estimation */
+    worker_pool_.ParallelFor(num_environments, [&](int64_t i) {
+      rollout.ComputeReturns(first_episode + i, 0.99, 0.95);
+    });
+  }
+
+  return rollout;
+}
+
+int64_t VectorizedRunner::NumEnvironments() const {
+  return static_cast<int64_t>(environments_.size());
+}
+
+void VectorizedRunner::SetQuantizedInference(bool enabled) {
+  quantized_inference_ = enabled;
+}
+
+void VectorizedRunner::ReadState(int64_t i) {
+  Environment& environment = environments_[i];
+
+  states_[i].copy_(GetGlobalState(environment.referee,
+                                  environment.vision_client, own_team_,
+                                  opponent_team_)
+                       .reshape({num_global_states}));
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,167 @@
+/* vectorized_runner.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Collects rollouts from several environments at once, with one
+ * policy forward pass for the agents of all environments per time step.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_VECTORIZEDRUNNER_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_VECTORIZEDRUNNER_H_
+
+#include "../../src/common_types.h"
+#include "../../src/simulation-interface/team_command_channel.h"
+#include "../../src/ssl-interface/automated_referee.h"
+#include "../../src/ssl-interface/ssl_vision_client.h"
+#include "network.h"
+#include "rollout_storage.h"
+#include "run_state.h"
+#include "stdint.h"
+#include "torch/torch.h"
+#include "vector"
+#include "worker_pool.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief The interfaces of one game that data is collected from, either a
+ * grSim instance or an in-process simulator.
+ *
+ * The interfaces are not owned, and must outlive the runner they are given
+ * to. The interfaces of different environments must not be shared, since the
+ * environments are stepped concurrently.
+ */
+struct Environment {
+  /*!
+   * @brief Automated referee of the game.
+   */
+  ssl_interface::AutomatedReferee& referee;
+
+  /*!
+   * @brief Vision client observing the game.
+   */
+  ssl_interface::VisionClient& vision_client;
+
+  /*!
+   * @brief Channel sending the commands of the robots of the own team.
+   */
+  simulation_interface::TeamCommandChannel& command_channel;
+};
+
+/*!
+ * @brief Class that collects rollouts from several environments in lockstep.
+ *
+ * Every time step, the environments are stepped in parallel on a worker pool,
+ * and the agents of all environments then choose their actions with a single
+ * forward pass of the critic and the policy network. With N environments this
+ * gives N times as many time steps per forward pass as MappoRun, and each
+ * environment behaves as it would in MappoRun.
+ *
+ * With quantized inference, every Run() first converts the networks it is
+ * given to copies with int8 weights, DynamicQuantizedPolicy and
+ * DynamicQuantizedCritic, and collects the rollout with those. The recorded
+ * probabilities and values are those of the quantized networks.
+ *
+ * @note Not copyable, not moveable.
+ */
+class VectorizedRunner
+{
+ public:
+  /*!
+   * @brief Constructor that starts the worker pool.
+   *
+   * @param[in] environments The environments to collect data from.
+   *
+   * @param[in] own_team The team that the agents are in, in all environments.
+   *
+   * @param[in] num_threads Number of threads stepping the environments,
+   * including the calling thread. Defaults to one per environment.
+   */
+  VectorizedRunner(std::vector<Environment> environments, Team own_team,
+                   int num_threads = 0);
+
+  /*!
+   * @brief Runs episodes in all environments and collects the data.
+   *
+   * @details The referees of the environments must have been started with
+   * StartGame().
+   *
+   * @param[in] policy is the policy network which is used by all agents.
+   *
+   * @param[in] critic is the critic network estimating the values.
+   *
+   * @param[in] episodes_per_environment Number of episodes run in each
+   * environment.
+   *
+   * @returns The collected data of episodes_per_environment *
+   * NumEnvironments() episodes of max_timesteps - 1 time steps, including the
+   * reward-to-go and general advantage estimation. Episode e of environment i
+   * is stored as episode e * NumEnvironments() + i.
+   */
+  RolloutStorage Run(PolicyNetwork& policy, CriticNetwork& critic,
+                     int64_t episodes_per_environment);
+
+  /*!
+   * @brief Returns the number of environments.
+   */
+  int64_t NumEnvironments() const;
+
+  /*!
+   * @brief Sets whether rollouts are collected with int8 copies of the
+   * networks, off by default.
+   */
+  void SetQuantizedInference(bool enabled);
+
+ protected:
+  /*!
+   * @brief Reads the global state of an environment into row i of states_.
+   */
+  void ReadState(int64_t i);
+
+  /*!
+   * @brief The environments.
+   */
+  std::vector<Environment> environments_;
+
+  /*!
+   * @brief Reward state of each environment.
+   */
+  std::vector<RunState> run_states_;
+
+  /*!
+   * @brief The team that the agents are in.
+   */
+  Team own_team_;
+
+  /*!
+   * @brief The opponent of own_team_.
+   */
+  Team opponent_team_;
+
+  /*!
+   * @brief Threads stepping the environments.
+   */
+  WorkerPool worker_pool_;
+
+  /*!
+   * @brief Current global state of every environment, [num_environments,
+   * num_global_states].
+   */
+  torch::Tensor states_;
+
+  /*!
+   * @brief Whether rollouts are collected with int8 copies of the networks.
+   */
+  bool quantized_inference_;
+};
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_VECTORIZEDRUNNER_H_ */
@@ -0,0 +1,119 @@
+/* worker_pool.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Fixed set of worker threads that run the iterations of a loop
+ * in parallel.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#include "worker_pool.h"
+#include "atomic"
+#include "condition_variable"
+#include "cstdint"
+#include "exception"
+#include "functional"
+#include "mutex"
+#include "thread"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+WorkerPool::WorkerPool(int num_threads)
+    : task_(nullptr), count_(0), next_index_(0), generation_(0),
+      busy_workers_(0), stopping_(false) {
+  /* The calling thread is one of the threads */
+  for (int i = 1; i < num_threads; i++) {
+    threads_.emplace_back(&WorkerPool::WorkerLoop, this);
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  loop_started_.notify_all();
+
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkerPool::ParallelFor(int64_t count,
+                             const std::function<void(int64_t)>& task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    count_ = count;
+    next_index_.store(0, std::memory_order_relaxed);
+    error_ = nullptr;
+    busy_workers_ = static_cast<int>(threads_.size());
+    generation_++;
+  }
+  loop_started_.notify_all();
+
+  RunIterations();
+
+  /* The task must outlive every worker that may still be running it */
+  std::unique_lock<std::mutex> lock(mutex_);
+  loop_finished_.wait(lock, [this] { return busy_workers_ == 0; });
+  task_ = nullptr;
+
+  if (error_) {
+    std::rethrow_exception(error_);
+  }
+}
+
+int WorkerPool::NumThreads() const {
+  return static_cast<int>(threads_.size()) + 1;
+}
+
+void WorkerPool::WorkerLoop() {
+  uint64_t finished_generation = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      loop_started_.wait(lock, [&] {
+        return stopping_ || generation_ != finished_generation;
+      });
+      if (stopping_) {
+        return;
+      }
+      finished_generation = generation_;
+    }
+
+    RunIterations();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      busy_workers_--;
+      if (busy_workers_ == 0) {
+        loop_finished_.notify_one();
+      }
+    }
+  }
+}
+
+void WorkerPool::RunIterations() {
+  for (int64_t i = next_index_.fetch_add(1, std::memory_order_relaxed);
+       i < count_; i = next_index_.fetch_add(1, std::memory_order_relaxed)) {
+    try {
+      (*task_)(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+  }
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,153 @@
+/* worker_pool.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Fixed set of worker threads that run the iterations of a loop
+ * in parallel.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_WORKERPOOL_H_
+#define CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_WORKERPOOL_H_
+
+#include "atomic"
+#include "condition_variable"
+#include "cstdint"
+#include "exception"
+#include "functional"
+#include "mutex"
+#include "thread"
+#include "vector"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/*!
+ * @brief Class that runs the iterations of a loop on a fixed set of threads.
+ *
+ * The threads are started once and wait between calls to ParallelFor(), so
+ * a loop that is run every time step does not pay for creating threads. The
+ * calling thread takes part in the work.
+ *
+ * @note Not copyable, not moveable.
+ */
+class WorkerPool
+{
+ public:
+  /*!
+   * @brief Constructor that starts the worker threads.
+   *
+   * @param[in] num_threads Number of threads that run iterations, including
+   * the thread calling ParallelFor(). Values below 1 are treated as 1, which
+   * runs every iteration on the calling thread.
+   */
+  explicit WorkerPool(int num_threads);
+
+  /*!
+   * @brief Destructor that stops and joins the worker threads.
+   */
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /*!
+   * @brief Runs task(i) for every i in [0, count) and returns when all of
+   * them are done.
+   *
+   * The iterations run in any order and on any thread, so task must be safe
+   * to call concurrently for different i.
+   *
+   * @param[in] count Number of iterations.
+   *
+   * @param[in] task Function called with the index of each iteration.
+   *
+   * @throws The first exception thrown by task, after all iterations have
+   * finished.
+   */
+  void ParallelFor(int64_t count, const std::function<void(int64_t)>& task);
+
+  /*!
+   * @brief Returns the number of threads that run iterations, including the
+   * calling thread.
+   */
+  int NumThreads() const;
+
+ protected:
+  /*!
+   * @brief Loop of each worker thread, which waits for a call to
+   * ParallelFor() and then takes part in it.
+   */
+  void WorkerLoop();
+
+  /*!
+   * @brief Claims and runs iterations of the current loop until there are
+   * none left.
+   */
+  void RunIterations();
+
+  /*!
+   * @brief The worker threads.
+   */
+  std::vector<std::thread> threads_;
+
+  /*!
+   * @brief Protects the state of the current loop.
+   */
+  std::mutex mutex_;
+
+  /*!
+   * @brief Wakes the workers when a loop starts or the pool is stopped.
+   */
+  std::condition_variable loop_started_;
+
+  /*!
+   * @brief Wakes the caller of ParallelFor() when the last worker is done.
+   */
+  std::condition_variable loop_finished_;
+
+  /*!
+   * @brief Function of the current loop.
+   */
+  const std::function<void(int64_t)>* task_;
+
+  /*!
+   * @brief Number of iterations of the current loop.
+   */
+  int64_t count_;
+
+  /*!
+   * @brief Index of the next iteration that has not been claimed.
+   */
+  std::atomic<int64_t> next_index_;
+
+  /*!
+   * @brief Incremented for every loop, so the workers can tell a new loop
+   * from the one they already finished.
+   */
+  uint64_t generation_;
+
+  /*!
+   * @brief Number of workers that have not finished the current loop.
+   */
+  int busy_workers_;
+
+  /*!
+   * @brief Set when the pool is destroyed.
+   */
+  bool stopping_;
+
+  /*!
+   * @brief First exception thrown by the task of the current loop.
+   */
+  std::exception_ptr error_;
+};
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_COLLECTIVEROBOTBEHAVIOUR_WORKERPOOL_H_ */
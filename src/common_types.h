@@ -32,6 +32,12 @@ static constexpr int kMaxUdpPacketSize = 65536;
  */
 const int max_timesteps = 201;
 
+/*!
+ * @brief Number of consecutive time steps in each chunk of a trajectory that
+ * the recurrent networks are trained on.
+ */
+const int chunk_length = 10;
+
 /*!
  * @brief Length of the experience replay buffer.
  */
@@ -60,6 +66,33 @@ const float entropy_coefficient = 0.3;
  */
 const float clip_value = 0.2;
 
+/*!
+ * @brief Number of passes over each rollout when training the networks.
+ */
+const int ppo_epochs = 5;
+
+/*!
+ * @brief Number of mini batches, and optimizer steps, per pass over a rollout.
+ */
+const int ppo_mini_batches = 1;
+
+/*!
+ * @brief Training on a rollout stops after the first pass whose mean
+ * approximate KL divergence from the collecting policy exceeds this value.
+ * Zero or less never stops early.
+ */
+const float target_kl = 0.02;
+
+/*!
+ * @brief Learning rate of the Adam optimizers of the networks.
+ */
+const float learning_rate = 1e-4;
+
+/*!
+ * @brief Maximum gradient norm of each network in an optimizer step.
+ */
+const float max_gradient_norm = 0.2;
+
 /*!
  * @brief Represents the number of global states or observation.
  */
@@ -90,6 +123,23 @@ static constexpr float kRobotRadius = 85;
  */
 static constexpr float kBallRadius = 21.5;
 
+/*!
+ * @brief Half the length of the field in mm, i.e. the x coordinate of the goal
+ * lines.
+ */
+static constexpr float kFieldHalfLength = 4500;
+
+/*!
+ * @brief Half the width of the field in mm, i.e. the y coordinate of the touch
+ * lines.
+ */
+static constexpr float kFieldHalfWidth = 3000;
+
+/*!
+ * @brief Half the width of the goals in mm.
+ */
+static constexpr float kGoalHalfWidth = 500;
+
 /*!
  * @brief Enum representing player team selection.
  */
@@ -0,0 +1,295 @@
+/* headless_simulator.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Deterministic 2D simulator of an SSL game that runs in-process
+ * and faster than real time.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* Related .h files */
+#include "../headless-simulation/headless_simulator.h"
+
+/* C++ standard library headers */
+#include "algorithm"
+#include "cmath"
+#include "stdexcept"
+
+/* Project .h files */
+#include "../ssl-interface/simulation_reset.h"
+#include "../common_types.h"
+
+namespace centralised_ai
+{
+namespace headless_simulation
+{
+
+/* Constructor */
+HeadlessSimulator::HeadlessSimulator() : time_(0)
+{
+  ResetRobotsAndBall(Team::kBlue);
+}
+
+/* Place robots and ball at the kickoff positions */
+void HeadlessSimulator::ResetRobotsAndBall(enum Team team_on_positive_half)
+{
+  int side;
+
+  for (auto team : {Team::kBlue, Team::kYellow})
+  {
+    /* Same positions as sent to grSim, converted from m to mm */
+    side = (team == team_on_positive_half) ? 1 : -1;
+    for (int id = 0; id < amount_of_players_in_team; id++)
+    {
+      SetRobotPose(id, team,
+                   side * ssl_interface::kInitialPositionX[id] * 1000,
+                   ssl_interface::kInitialPositionY[id] * 1000,
+                   (side == 1) ? M_PI : 0);
+    }
+  }
+
+  SetBall(0, 0, 0, 0);
+}
+
+/* Set the velocity command of a robot */
+void HeadlessSimulator::SetRobotVelocity(int id, enum Team team,
+    float x_speed, float y_speed, float angular_speed)
+{
+  Robot& robot = GetRobot(id, team);
+
+  robot.command_x = x_speed;
+  robot.command_y = y_speed;
+  robot.command_angular = angular_speed;
+}
+
+/* Place a robot and stop it */
+void HeadlessSimulator::SetRobotPose(int id, enum Team team, float x,
+    float y, float orientation)
+{
+  GetRobot(id, team) = {x, y, orientation, 0, 0, 0, 0, 0};
+}
+
+/* Place the ball */
+void HeadlessSimulator::SetBall(float x, float y, float velocity_x,
+    float velocity_y)
+{
+  ball_ = {x, y, velocity_x, velocity_y};
+}
+
+/* Advance the simulation by one vision frame */
+void HeadlessSimulator::Step()
+{
+  const float kSubTimeStep = kTimeStep / kSubSteps;
+
+  for (int sub_step = 0; sub_step < kSubSteps; sub_step++)
+  {
+    MoveRobots(kSubTimeStep);
+    SeparateRobots();
+    MoveBall(kSubTimeStep);
+  }
+
+  time_ += kTimeStep;
+}
+
+/* Move the robots according to their commands */
+void HeadlessSimulator::MoveRobots(float time_step)
+{
+  const float kMaxX = kFieldHalfLength + kBoundaryWidth - kRobotRadius;
+  const float kMaxY = kFieldHalfWidth + kBoundaryWidth - kRobotRadius;
+  float cos_orientation;
+  float sin_orientation;
+
+  for (auto& team : robots_)
+  {
+    for (Robot& robot : team)
+    {
+      /* Rotate the command from the robot frame into the field frame, and
+       * from m/s to mm/s */
+      cos_orientation = std::cos(robot.orientation);
+      sin_orientation = std::sin(robot.orientation);
+      robot.velocity_x = 1000 * (robot.command_x * cos_orientation -
+          robot.command_y * sin_orientation);
+      robot.velocity_y = 1000 * (robot.command_x * sin_orientation +
+          robot.command_y * cos_orientation);
+
+      robot.x = std::clamp(robot.x + robot.velocity_x * time_step, -kMaxX,
+                           kMaxX);
+      robot.y = std::clamp(robot.y + robot.velocity_y * time_step, -kMaxY,
+                           kMaxY);
+      robot.orientation = std::remainder(
+          robot.orientation + robot.command_angular * time_step, 2 * M_PI);
+    }
+  }
+}
+
+/* Push overlapping robots apart */
+void HeadlessSimulator::SeparateRobots()
+{
+  Robot* all_robots = &robots_[0][0];
+  const int kRobotCount = 2 * amount_of_players_in_team;
+  float dx;
+  float dy;
+  float distance;
+  float push;
+
+  for (int i = 0; i < kRobotCount; i++)
+  {
+    for (int j = i + 1; j < kRobotCount; j++)
+    {
+      dx = all_robots[j].x - all_robots[i].x;
+      dy = all_robots[j].y - all_robots[i].y;
+      distance = std::sqrt(dx * dx + dy * dy);
+      if (distance >= 2 * kRobotRadius)
+      {
+        continue;
+      }
+
+      /* Robots on top of each other are separated along the x axis */
+      if (distance == 0)
+      {
+        dx = 1;
+        dy = 0;
+        distance = 1;
+      }
+
+      /* Move both robots half of the overlap */
+      push = (2 * kRobotRadius - distance) / (2 * distance);
+      all_robots[i].x -= dx * push;
+      all_robots[i].y -= dy * push;
+      all_robots[j].x += dx * push;
+      all_robots[j].y += dy * push;
+    }
+  }
+}
+
+/* Move the ball and handle its collisions */
+void HeadlessSimulator::MoveBall(float time_step)
+{
+  const float kMaxX = kFieldHalfLength + kBoundaryWidth - kBallRadius;
+  const float kMaxY = kFieldHalfWidth + kBoundaryWidth - kBallRadius;
+  const float kContactDistance = kRobotRadius + kBallRadius;
+  float speed;
+  float slowed_speed;
+  float dx;
+  float dy;
+  float distance;
+  float normal_speed;
+
+  /* Roll and slow down with constant deceleration */
+  ball_.x += ball_.velocity_x * time_step;
+  ball_.y += ball_.velocity_y * time_step;
+  speed = std::sqrt(ball_.velocity_x * ball_.velocity_x +
+                    ball_.velocity_y * ball_.velocity_y);
+  if (speed > 0)
+  {
+    slowed_speed = std::max(0.0F, speed - kBallDeceleration * time_step);
+    ball_.velocity_x *= slowed_speed / speed;
+    ball_.velocity_y *= slowed_speed / speed;
+  }
+
+  /* Bounce off robots */
+  for (auto& team : robots_)
+  {
+    for (Robot& robot : team)
+    {
+      dx = ball_.x - robot.x;
+      dy = ball_.y - robot.y;
+      distance = std::sqrt(dx * dx + dy * dy);
+      if (distance >= kContactDistance || distance == 0)
+      {
+        continue;
+      }
+
+      /* Move the ball out of the robot */
+      dx /= distance;
+      dy /= distance;
+      ball_.x = robot.x + dx * kContactDistance;
+      ball_.y = robot.y + dy * kContactDistance;
+
+      /* Reflect the velocity relative to the robot if they approach */
+      normal_speed = (ball_.velocity_x - robot.velocity_x) * dx +
+          (ball_.velocity_y - robot.velocity_y) * dy;
+      if (normal_speed < 0)
+      {
+        ball_.velocity_x -= (1 + kBallRestitution) * normal_speed * dx;
+        ball_.velocity_y -= (1 + kBallRestitution) * normal_speed * dy;
+      }
+    }
+  }
+
+  /* Bounce off walls */
+  if (std::abs(ball_.x) > kMaxX)
+  {
+    ball_.x = std::copysign(kMaxX, ball_.x);
+    ball_.velocity_x *= -kBallRestitution;
+  }
+  if (std::abs(ball_.y) > kMaxY)
+  {
+    ball_.y = std::copysign(kMaxY, ball_.y);
+    ball_.velocity_y *= -kBallRestitution;
+  }
+}
+
+/* Return the robot with the given ID and team */
+HeadlessSimulator::Robot& HeadlessSimulator::GetRobot(int id, enum Team team)
+{
+  if (team == Team::kUnknown)
+  {
+    throw std::invalid_argument("Team must be kBlue or kYellow");
+  }
+
+  return robots_[static_cast<int>(team)][id];
+}
+
+/* Public getter for the simulated time */
+double HeadlessSimulator::GetTime()
+{
+  return time_;
+}
+
+/* Public getter for x coordinate of robot */
+float HeadlessSimulator::GetRobotPositionX(int id, enum Team team)
+{
+  return GetRobot(id, team).x;
+}
+
+/* Public getter for y coordinate of robot */
+float HeadlessSimulator::GetRobotPositionY(int id, enum Team team)
+{
+  return GetRobot(id, team).y;
+}
+
+/* Public getter for orientation of robot */
+float HeadlessSimulator::GetRobotOrientation(int id, enum Team team)
+{
+  return GetRobot(id, team).orientation;
+}
+
+/* Public getter for x coordinate of ball */
+float HeadlessSimulator::GetBallPositionX()
+{
+  return ball_.x;
+}
+
+/* Public getter for y coordinate of ball */
+float HeadlessSimulator::GetBallPositionY()
+{
+  return ball_.y;
+}
+
+/* Public getter for velocity of ball along the x axis */
+float HeadlessSimulator::GetBallVelocityX()
+{
+  return ball_.velocity_x;
+}
+
+/* Public getter for velocity of ball along the y axis */
+float HeadlessSimulator::GetBallVelocityY()
+{
+  return ball_.velocity_y;
+}
+
+} /* namespace headless_simulation */
+} /* namespace centralised_ai */
@@ -0,0 +1,258 @@
+/* headless_simulator.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Deterministic 2D simulator of an SSL game that runs in-process
+ * and faster than real time.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_HEADLESSSIMULATION_HEADLESSSIMULATOR_H_
+#define CENTRALISEDAI_HEADLESSSIMULATION_HEADLESSSIMULATOR_H_
+
+/* Project .h files */
+#include "../common_types.h"
+
+namespace centralised_ai
+{
+namespace headless_simulation
+{
+
+/*!
+ * @brief Class simulating robots and ball on an SSL field in 2D.
+ *
+ * Robots are discs that follow holonomic velocity commands given in their
+ * own frame, like the velocity commands of grSim. The ball rolls with
+ * constant deceleration and bounces off robots and the field walls. Robots
+ * push each other apart when they overlap. The field dimensions are those
+ * that the automated referee uses. Each call to Step() advances the game by
+ * one vision frame, and the same commands from the same state always give
+ * the same result.
+ *
+ * @note Copyable, moveable.
+ */
+class HeadlessSimulator
+{
+ public:
+  /*!
+   * @brief Constructor that places robots and ball at the kickoff positions,
+   * with the blue team on the positive half.
+   */
+  HeadlessSimulator();
+
+  /*!
+   * @brief Places robots and ball at the kickoff positions and stops them.
+   *
+   * Uses the same positions as ssl_interface::ResetRobotsAndBall().
+   *
+   * @param[in] team_on_positive_half The team that has its goal on the
+   * positive half of the field.
+   */
+  void ResetRobotsAndBall(enum Team team_on_positive_half);
+
+  /*!
+   * @brief Sets the velocity command of a robot.
+   *
+   * @param[in] id ID of the robot.
+   *
+   * @param[in] team Team of the robot.
+   *
+   * @param[in] x_speed Speed in m/s in the direction the robot is facing.
+   *
+   * @param[in] y_speed Speed in m/s to the left of the robot.
+   *
+   * @param[in] angular_speed Anti-clockwise angular speed in radians/s.
+   *
+   * @throws std::invalid_argument if called with argument Team::kUnknown.
+   */
+  void SetRobotVelocity(int id, enum Team team, float x_speed, float y_speed,
+                        float angular_speed);
+
+  /*!
+   * @brief Places a robot at a position and stops it.
+   *
+   * @param[in] id ID of the robot.
+   *
+   * @param[in] team Team of the robot.
+   *
+   * @param[in] x X coordinate in mm.
+   *
+   * @param[in] y Y coordinate in mm.
+   *
+   * @param[in] orientation Orientation in radians.
+   *
+   * @throws std::invalid_argument if called with argument Team::kUnknown.
+   */
+  void SetRobotPose(int id, enum Team team, float x, float y,
+                    float orientation);
+
+  /*!
+   * @brief Places the ball at a position with a velocity.
+   *
+   * @param[in] x X coordinate in mm.
+   *
+   * @param[in] y Y coordinate in mm.
+   *
+   * @param[in] velocity_x Velocity along the x axis in mm/s.
+   *
+   * @param[in] velocity_y Velocity along the y axis in mm/s.
+   */
+  void SetBall(float x, float y, float velocity_x, float velocity_y);
+
+  /*!
+   * @brief Advances the simulation by one vision frame, kTimeStep seconds.
+   */
+  void Step();
+
+  /*!
+   * @brief Returns the simulated time in seconds since construction.
+   *
+   * @return Simulated time in seconds.
+   */
+  double GetTime();
+
+  /*!
+   * @brief Returns the x coordinate in mm of a robot.
+   *
+   * @throws std::invalid_argument if called with argument Team::kUnknown.
+   */
+  float GetRobotPositionX(int id, enum Team team);
+
+  /*!
+   * @brief Returns the y coordinate in mm of a robot.
+   *
+   * @throws std::invalid_argument if called with argument Team::kUnknown.
+   */
+  float GetRobotPositionY(int id, enum Team team);
+
+  /*!
+   * @brief Returns the orientation in radians of a robot, in the range
+   * [-pi, pi].
+   *
+   * @throws std::invalid_argument if called with argument Team::kUnknown.
+   */
+  float GetRobotOrientation(int id, enum Team team);
+
+  /*!
+   * @brief Returns the x coordinate of the ball in mm.
+   */
+  float GetBallPositionX();
+
+  /*!
+   * @brief Returns the y coordinate of the ball in mm.
+   */
+  float GetBallPositionY();
+
+  /*!
+   * @brief Returns the velocity of the ball along the x axis in mm/s.
+   */
+  float GetBallVelocityX();
+
+  /*!
+   * @brief Returns the velocity of the ball along the y axis in mm/s.
+   */
+  float GetBallVelocityY();
+
+  /*!
+   * @brief Simulated time in seconds of one call to Step(), equal to the
+   * 60 Hz frame rate of vision.
+   */
+  static constexpr double kTimeStep = 1.0 / 60.0;
+
+  /*!
+   * @brief Number of integration steps per call to Step().
+   */
+  static constexpr int kSubSteps = 4;
+
+  /*!
+   * @brief Width in mm of the area between the field lines and the walls.
+   */
+  static constexpr float kBoundaryWidth = 300;
+
+  /*!
+   * @brief Deceleration in mm/s^2 of the rolling ball.
+   */
+  static constexpr float kBallDeceleration = 400;
+
+  /*!
+   * @brief Fraction of the normal speed the ball keeps when it bounces.
+   */
+  static constexpr float kBallRestitution = 0.5;
+
+ protected:
+  /*!
+   * @brief State of one robot.
+   */
+  struct Robot
+  {
+    float x;
+    float y;
+    float orientation;
+
+    /* Commanded velocity in the robot frame, in m/s and radians/s */
+    float command_x;
+    float command_y;
+    float command_angular;
+
+    /* Velocity in the field frame in mm/s, derived from the command */
+    float velocity_x;
+    float velocity_y;
+  };
+
+  /*!
+   * @brief State of the ball.
+   */
+  struct Ball
+  {
+    float x;
+    float y;
+    float velocity_x;
+    float velocity_y;
+  };
+
+  /*!
+   * @brief All robots, indexed by team and then by ID.
+   */
+  Robot robots_[2][amount_of_players_in_team];
+
+  /*!
+   * @brief The ball.
+   */
+  Ball ball_;
+
+  /*!
+   * @brief Simulated time in seconds.
+   */
+  double time_;
+
+  /*!
+   * @brief Returns the robot with the given ID and team.
+   *
+   * @throws std::invalid_argument if called with argument Team::kUnknown.
+   */
+  Robot& GetRobot(int id, enum Team team);
+
+  /*!
+   * @brief Moves the robots according to their commands and keeps them
+   * inside the walls.
+   */
+  void MoveRobots(float time_step);
+
+  /*!
+   * @brief Pushes overlapping robots apart.
+   */
+  void SeparateRobots();
+
+  /*!
+   * @brief Moves the ball, slows it down and bounces it off robots and
+   * walls.
+   */
+  void MoveBall(float time_step);
+};
+
+} /* namespace headless_simulation */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_HEADLESSSIMULATION_HEADLESSSIMULATOR_H_ */
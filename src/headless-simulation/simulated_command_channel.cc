@@ -0,0 +1,56 @@
+/* simulated_command_channel.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Team command channel that applies the commands to the headless
+ * simulator instead of sending them to grSim.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* Related .h files */
+#include "../headless-simulation/simulated_command_channel.h"
+
+/* Project .h files */
+#include "../headless-simulation/headless_simulator.h"
+#include "../simulation-interface/generated/grsim_commands.pb.h"
+#include "../simulation-interface/team_command_channel.h"
+#include "../common_types.h"
+
+namespace centralised_ai
+{
+namespace headless_simulation
+{
+
+/* Constructor */
+SimulatedCommandChannel::SimulatedCommandChannel(HeadlessSimulator& simulator,
+    enum Team team, int robot_count)
+    : simulation_interface::TeamCommandChannel(team, robot_count),
+      simulator_(simulator), team_(team)
+{
+}
+
+/* Apply the commands of all robots and step the simulator */
+void SimulatedCommandChannel::SendPacket()
+{
+  for (const GrSimRobotCommand& command :
+       packet_.commands().robot_commands())
+  {
+    if (command.wheels_speed())
+    {
+      simulator_.SetRobotVelocity(command.id(), team_, 0, 0, 0);
+    }
+    else
+    {
+      simulator_.SetRobotVelocity(command.id(), team_, command.vel_tangent(),
+                                  command.vel_normal(),
+                                  command.vel_angular());
+    }
+  }
+
+  simulator_.Step();
+}
+
+} /* namespace headless_simulation */
+} /* namespace centralised_ai */
@@ -0,0 +1,72 @@
+/* simulated_command_channel.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Team command channel that applies the commands to the headless
+ * simulator instead of sending them to grSim.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_HEADLESSSIMULATION_SIMULATEDCOMMANDCHANNEL_H_
+#define CENTRALISEDAI_HEADLESSSIMULATION_SIMULATEDCOMMANDCHANNEL_H_
+
+/* Project .h files */
+#include "../headless-simulation/headless_simulator.h"
+#include "../simulation-interface/team_command_channel.h"
+#include "../common_types.h"
+
+namespace centralised_ai
+{
+namespace headless_simulation
+{
+
+/*!
+ * @brief Command channel that controls one team of a HeadlessSimulator.
+ *
+ * Has the same setters as simulation_interface::TeamCommandChannel. Each call
+ * to SendPacket() applies the velocity commands of the team and advances the
+ * simulator by one step, so a control loop that sends once per vision frame
+ * runs in lockstep with the simulator. Wheel speed, kicker and spinner
+ * commands are not simulated; a robot commanded by wheel speeds stands still.
+ *
+ * @note Not copyable, not moveable.
+ */
+class SimulatedCommandChannel : public simulation_interface::TeamCommandChannel
+{
+ public:
+  /*!
+   * @brief Constructor that controls a team of a simulator.
+   *
+   * @param[in] simulator The simulator to control, must outlive the channel.
+   *
+   * @param[in] team Team color of the robots that are controlled.
+   *
+   * @param[in] robot_count Number of robots controlled, with IDs 0 to
+   * robot_count - 1.
+   */
+  SimulatedCommandChannel(HeadlessSimulator& simulator, enum Team team,
+                          int robot_count = amount_of_players_in_team);
+
+  /*!
+   * @brief Applies the commands of all robots and steps the simulator.
+   */
+  void SendPacket() override;
+
+ protected:
+  /*!
+   * @brief The controlled simulator.
+   */
+  HeadlessSimulator& simulator_;
+
+  /*!
+   * @brief Team color of the robots that are controlled.
+   */
+  enum Team team_;
+};
+
+} /* namespace headless_simulation */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_HEADLESSSIMULATION_SIMULATEDCOMMANDCHANNEL_H_ */
@@ -0,0 +1,40 @@
+/* simulated_referee.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Automated referee that resets the headless simulator instead
+ * of grSim.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* Related .h files */
+#include "../headless-simulation/simulated_referee.h"
+
+/* Project .h files */
+#include "../headless-simulation/headless_simulator.h"
+#include "../ssl-interface/automated_referee.h"
+#include "../ssl-interface/ssl_vision_client.h"
+
+namespace centralised_ai
+{
+namespace headless_simulation
+{
+
+/* Constructor */
+SimulatedReferee::SimulatedReferee(ssl_interface::VisionClient& vision_client,
+    HeadlessSimulator& simulator)
+    : ssl_interface::AutomatedReferee(vision_client, "", 0),
+      simulator_(simulator)
+{
+}
+
+/* Reset robots and ball in the simulator */
+void SimulatedReferee::ResetField()
+{
+  simulator_.ResetRobotsAndBall(team_on_positive_half_);
+}
+
+} /* namespace headless_simulation */
+} /* namespace centralised_ai */
@@ -0,0 +1,63 @@
+/* simulated_referee.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Automated referee that resets the headless simulator instead
+ * of grSim.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_HEADLESSSIMULATION_SIMULATEDREFEREE_H_
+#define CENTRALISEDAI_HEADLESSSIMULATION_SIMULATEDREFEREE_H_
+
+/* Project .h files */
+#include "../headless-simulation/headless_simulator.h"
+#include "../ssl-interface/automated_referee.h"
+#include "../ssl-interface/ssl_vision_client.h"
+
+namespace centralised_ai
+{
+namespace headless_simulation
+{
+
+/*!
+ * @brief Automated referee for a game played in a HeadlessSimulator.
+ *
+ * Applies the same rules as ssl_interface::AutomatedReferee, but places
+ * robots and ball at their kickoff positions directly in the simulator
+ * instead of sending a replacement packet to grSim.
+ *
+ * @note Not copyable, not moveable.
+ */
+class SimulatedReferee : public ssl_interface::AutomatedReferee
+{
+ public:
+  /*!
+   * @brief Constructor for a referee of a simulated game.
+   *
+   * @param[in] vision_client A reference to the vision client observing the
+   * simulator.
+   *
+   * @param[in] simulator The simulator to reset, must outlive the referee.
+   */
+  SimulatedReferee(ssl_interface::VisionClient& vision_client,
+                   HeadlessSimulator& simulator);
+
+ protected:
+  /*!
+   * @brief Resets robots and ball in the simulator.
+   */
+  void ResetField() override;
+
+  /*!
+   * @brief The simulator that is reset.
+   */
+  HeadlessSimulator& simulator_;
+};
+
+} /* namespace headless_simulation */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_HEADLESSSIMULATION_SIMULATEDREFEREE_H_ */
@@ -0,0 +1,61 @@
+/* simulated_vision_client.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Vision client that reads robot and ball positions from the
+ * headless simulator instead of ssl Vision.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* Related .h files */
+#include "../headless-simulation/simulated_vision_client.h"
+
+/* Project .h files */
+#include "../headless-simulation/headless_simulator.h"
+#include "../ssl-interface/ssl_vision_client.h"
+#include "../common_types.h"
+
+namespace centralised_ai
+{
+namespace headless_simulation
+{
+
+/* Constructor */
+SimulatedVisionClient::SimulatedVisionClient(HeadlessSimulator& simulator)
+    : ssl_interface::VisionClient(), simulator_(simulator)
+{
+}
+
+/* Copy the current state of the simulator */
+void SimulatedVisionClient::ReceivePacket()
+{
+  timestamp_ = simulator_.GetTime();
+
+  for (int id = 0; id < amount_of_players_in_team; id++)
+  {
+    blue_robot_positions_x_[id] =
+        simulator_.GetRobotPositionX(id, Team::kBlue);
+    blue_robot_positions_y_[id] =
+        simulator_.GetRobotPositionY(id, Team::kBlue);
+    blue_robot_orientations_[id] =
+        simulator_.GetRobotOrientation(id, Team::kBlue);
+    blue_robot_positions_read_[id] = true;
+
+    yellow_robot_positions_x_[id] =
+        simulator_.GetRobotPositionX(id, Team::kYellow);
+    yellow_robot_positions_y_[id] =
+        simulator_.GetRobotPositionY(id, Team::kYellow);
+    yellow_robot_orientations_[id] =
+        simulator_.GetRobotOrientation(id, Team::kYellow);
+    yellow_robot_positions_read_[id] = true;
+  }
+
+  ball_position_x_ = simulator_.GetBallPositionX();
+  ball_position_y_ = simulator_.GetBallPositionY();
+  ball_data_read_ = true;
+}
+
+} /* namespace headless_simulation */
+} /* namespace centralised_ai */
@@ -0,0 +1,59 @@
+/* simulated_vision_client.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Vision client that reads robot and ball positions from the
+ * headless simulator instead of ssl Vision.
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_HEADLESSSIMULATION_SIMULATEDVISIONCLIENT_H_
+#define CENTRALISEDAI_HEADLESSSIMULATION_SIMULATEDVISIONCLIENT_H_
+
+/* Project .h files */
+#include "../headless-simulation/headless_simulator.h"
+#include "../ssl-interface/ssl_vision_client.h"
+
+namespace centralised_ai
+{
+namespace headless_simulation
+{
+
+/*!
+ * @brief Vision client that observes a HeadlessSimulator.
+ *
+ * Has the same getters as ssl_interface::VisionClient, so code written for
+ * ssl Vision runs unchanged against the simulator. ReceivePacket() never
+ * blocks, it copies the current state of the simulator. The timestamp is the
+ * simulated time.
+ *
+ * @note Not copyable, not moveable.
+ */
+class SimulatedVisionClient : public ssl_interface::VisionClient
+{
+ public:
+  /*!
+   * @brief Constructor that observes a simulator.
+   *
+   * @param[in] simulator The simulator to observe, must outlive the client.
+   */
+  explicit SimulatedVisionClient(HeadlessSimulator& simulator);
+
+  /*!
+   * @brief Read the current robot and ball positions from the simulator.
+   */
+  void ReceivePacket() override;
+
+ protected:
+  /*!
+   * @brief The observed simulator.
+   */
+  HeadlessSimulator& simulator_;
+};
+
+} /* namespace headless_simulation */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_HEADLESSSIMULATION_SIMULATEDVISIONCLIENT_H_ */
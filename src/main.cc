@@ -9,13 +9,32 @@
  */
 
 /* C++ standard library */
+#include "algorithm"
+#include "cctype"
+#include "chrono"
+#include "cstdlib"
+#include "cstring"
+#include "memory"
+#include "thread"
 #include "vector"
 
 /* Project .h files */
+#include "collective-robot-behaviour/actor_learner_pipeline.h"
+#include "collective-robot-behaviour/dynamic_quantization.h"
 #include "collective-robot-behaviour/mappo.h"
+#include "collective-robot-behaviour/mappo_trainer.h"
 #include "collective-robot-behaviour/network.h"
+#include "collective-robot-behaviour/phase_timer.h"
+#include "collective-robot-behaviour/policy_quantization.h"
+#include "collective-robot-behaviour/rollout_storage.h"
 #include "collective-robot-behaviour/utils.h"
+#include "collective-robot-behaviour/vectorized_runner.h"
+#include "headless-simulation/headless_simulator.h"
+#include "headless-simulation/simulated_command_channel.h"
+#include "headless-simulation/simulated_referee.h"
+#include "headless-simulation/simulated_vision_client.h"
 #include "simulation-interface/simulation_interface.h"
+#include "simulation-interface/team_command_channel.h"
 #include "ssl-interface/ssl_vision_client.h"
 
 #include "collective-robot-behaviour/communication.h"
@@ -29,7 +48,59 @@
 #include "pybind11/embed.h"
 #include "pybind11/stl.h"
 
-int main() {
+int main(int argc, char* argv[]) {
+  /* With --headless [environments] the games are played in in-process
+   * simulators instead of grSim, and training runs as fast as the simulators
+   * step. By default there is one simulator per core.
+   * With --pipelined [max staleness] the next rollout is collected while the
+   * networks train on the previous one, by default at most one update
+   * behind.
+   * With --checkpoint-interval [seconds] the networks are saved to disk at
+   * most this often, by default once a minute.
+   * With --debug-training every update runs with anomaly detection and checks
+   * of its predictions, losses and parameters.
+   * With --export-fixed-point <directory> every checkpoint also writes the
+   * policy as fixed point C source for the robots, calibrated on the latest
+   * rollout.
+   * With --quantized-rollouts the rollouts are collected with int8 copies of
+   * the networks, and every checkpoint reports how closely and how fast they
+   * reproduce the float networks.
+   * With --bf16-training the updates run the networks in bfloat16, with the
+   * weights, losses and optimizer state in float32. */
+  bool headless = false;
+  int num_environments = 1;
+  int64_t max_staleness = 0;
+  int checkpoint_interval = 60;
+  bool debug_training = false;
+  std::string fixed_point_directory;
+  bool quantized_rollouts = false;
+  bool bf16_training = false;
+  for (int i = 1; i < argc; i++) {
+    bool has_number = (i + 1 < argc) &&
+                      std::isdigit(static_cast<unsigned char>(argv[i + 1][0]));
+    if (std::strcmp(argv[i], "--headless") == 0) {
+      headless = true;
+      num_environments =
+          has_number ? std::atoi(argv[++i])
+                     : static_cast<int>(std::thread::hardware_concurrency());
+      num_environments = std::max(num_environments, 1);
+    } else if (std::strcmp(argv[i], "--pipelined") == 0) {
+      max_staleness = has_number ? std::atoi(argv[++i]) : 1;
+    } else if (std::strcmp(argv[i], "--checkpoint-interval") == 0 &&
+               has_number) {
+      checkpoint_interval = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--debug-training") == 0) {
+      debug_training = true;
+    } else if (std::strcmp(argv[i], "--export-fixed-point") == 0 &&
+               i + 1 < argc) {
+      fixed_point_directory = argv[++i];
+    } else if (std::strcmp(argv[i], "--quantized-rollouts") == 0) {
+      quantized_rollouts = true;
+    } else if (std::strcmp(argv[i], "--bf16-training") == 0) {
+      bf16_training = true;
+    }
+  }
+
   /* Create the centralised critic network class */
   centralised_ai::collective_robot_behaviour::CriticNetwork critic;
   // centralised_ai::collective_robot_behaviour::PolicyNetwork policy;
@@ -47,27 +118,70 @@ int main() {
   std::string grsim_ip = "127.0.0.1";
   int grsim_port = 20011;
 
-  /* Create the VisionClient instance with IP and port */
-  centralised_ai::ssl_interface::VisionClient vision_client(vision_ip,
-                                                            vision_port);
-  vision_client.ReceivePacketsUntilAllDataRead();
-
-  /* Create the AutomatedReferee instance with the VisionClient */
-  centralised_ai::ssl_interface::AutomatedReferee referee(vision_client,
-                                                          grsim_ip, grsim_port);
-
-  /* Start the automated referee */
-  referee.StartGame(centralised_ai::Team::kBlue, centralised_ai::Team::kYellow,
-                    3.0F, 300);
-
-  std::vector<centralised_ai::simulation_interface::SimulationInterface>
-      simulation_interfaces;
-  for (int32_t id = 0; id < centralised_ai::amount_of_players_in_team; id++) {
-    simulation_interfaces.push_back(
-        centralised_ai::simulation_interface::SimulationInterface(
-            grsim_ip, grsim_port, id, centralised_ai::Team::kBlue));
+  /* The environments that data is collected from */
+  std::vector<
+      std::unique_ptr<centralised_ai::headless_simulation::HeadlessSimulator>>
+      simulators;
+  std::vector<std::unique_ptr<centralised_ai::ssl_interface::VisionClient>>
+      vision_clients;
+  std::vector<std::unique_ptr<centralised_ai::ssl_interface::AutomatedReferee>>
+      referees;
+  std::vector<std::unique_ptr<
+      centralised_ai::simulation_interface::TeamCommandChannel>>
+      command_channels;
+
+  for (int i = 0; i < num_environments; i++) {
+    if (headless) {
+      simulators.push_back(std::make_unique<
+          centralised_ai::headless_simulation::HeadlessSimulator>());
+      vision_clients.push_back(std::make_unique<
+          centralised_ai::headless_simulation::SimulatedVisionClient>(
+          *simulators.back()));
+      referees.push_back(std::make_unique<
+          centralised_ai::headless_simulation::SimulatedReferee>(
+          *vision_clients.back(), *simulators.back()));
+      command_channels.push_back(std::make_unique<
+          centralised_ai::headless_simulation::SimulatedCommandChannel>(
+          *simulators.back(), centralised_ai::Team::kBlue));
+    } else {
+      /* Create the VisionClient instance with IP and port */
+      vision_clients.push_back(
+          std::make_unique<centralised_ai::ssl_interface::VisionClient>(
+              vision_ip, vision_port));
+      vision_clients.back()->ReceivePacketsUntilAllDataRead();
+
+      /* Read the newest frame each time step, even if training has fallen
+       * behind the vision frame rate */
+      vision_clients.back()->SetDrainQueuedPackets(true);
+
+      /* Create the AutomatedReferee instance with the VisionClient */
+      referees.push_back(
+          std::make_unique<centralised_ai::ssl_interface::AutomatedReferee>(
+              *vision_clients.back(), grsim_ip, grsim_port));
+
+      /* One channel sends the commands of the whole team every time step */
+      command_channels.push_back(std::make_unique<
+          centralised_ai::simulation_interface::TeamCommandChannel>(
+          grsim_ip, grsim_port, centralised_ai::Team::kBlue));
+    }
   }
 
+  /* All environments are stepped in lockstep, with one policy forward pass
+   * for the agents of all of them */
+  std::vector<centralised_ai::collective_robot_behaviour::Environment>
+      environments;
+  for (int i = 0; i < num_environments; i++) {
+    environments.push_back(
+        {*referees[i], *vision_clients[i], *command_channels[i]});
+  }
+  centralised_ai::collective_robot_behaviour::VectorizedRunner runner(
+      environments, centralised_ai::Team::kBlue);
+  runner.SetQuantizedInference(quantized_rollouts);
+
+  /* Collect at least batch_size episodes per epoch */
+  int64_t episodes_per_environment =
+      (centralised_ai::batch_size + num_environments - 1) / num_environments;
+
   /* Generate the file name from date. */
   /* Get current time */
   auto now = std::chrono::system_clock::now();
@@ -82,37 +196,83 @@ int main() {
   /* Create the file name */
   std::string reward_file_name = "../rewards/reward_" + oss.str() + ".csv";
   std::string losses_file_name = "../losses/losses_" + oss.str() + ".csv";
+  std::string timings_file_name = "../timings/timings_" + oss.str() + ".csv";
   std::cout << "File name to save rewards: " << reward_file_name << std::endl;
   std::cout << "File name to save losses: " << losses_file_name << std::endl;
+  std::cout << "File name to save phase timings: " << timings_file_name
+            << std::endl;
 
-  /* Save the initial state of the networks. */
-  centralised_ai::collective_robot_behaviour::SaveOldNetworks(policy, critic);
+  /* The trainer keeps the optimizer state of the networks between updates.
+   * Comment in to continue training from the saved checkpoint */
+  centralised_ai::collective_robot_behaviour::MappoTrainer trainer(policy,
+                                                                  critic);
+  // trainer.LoadCheckpoint();
+  if (debug_training) {
+    trainer.SetTrainingMode(
+        centralised_ai::collective_robot_behaviour::TrainingMode::kDebug);
+  }
+  if (bf16_training) {
+    trainer.SetTrainingPrecision(centralised_ai::collective_robot_behaviour::
+                                     TrainingPrecision::kBFloat16);
+  }
+
+  /* Saving to disk is kept out of the updates */
+  centralised_ai::collective_robot_behaviour::Checkpointer checkpointer(
+      std::chrono::seconds(checkpoint_interval));
+
+  /* Collection runs on its own thread, and with max_staleness 0 it
+   * alternates with training as a sequential loop would */
+  centralised_ai::collective_robot_behaviour::ActorLearnerPipeline pipeline(
+      runner, trainer, episodes_per_environment, max_staleness, [&]() {
+        for (auto& referee : referees) {
+          referee->StartGame(centralised_ai::Team::kBlue,
+                             centralised_ai::Team::kYellow, 3.0F, 300);
+        }
+      });
+  pipeline.Start();
 
   int epochs = 0;
   std::cout << "Running" << std::endl;
   while (true) {
-    referee.StartGame(centralised_ai::Team::kBlue,
-                      centralised_ai::Team::kYellow, 3.0F, 300);
-    /*run actions and save  to buffer*/
-    auto databuffer = centralised_ai::collective_robot_behaviour::MappoRun(
-        policy, critic, referee, vision_client, centralised_ai::Team::kBlue,
-        simulation_interfaces);
-
-    /*Run Mappo Agent algorithm by Policy Models and critic network*/
-    torch::Tensor losses =
-        centralised_ai::collective_robot_behaviour::MappoUpdate(policy, critic,
-                                                                databuffer);
-
-    /*Save the reward to go to a file*/
-    int32_t num_batches = databuffer.size();
-    int32_t num_time_steps = databuffer[0].t.size();
-    torch::Tensor rewards = torch::zeros({num_batches, num_time_steps});
-
-    for (int32_t b = 0; b < databuffer.size(); b++) {
-      for (int32_t t = 0; t < databuffer[b].t.size(); t++) {
-        rewards[b][t] = databuffer[b].t[t].rewards.mean();
+    /*Run Mappo Agent algorithm by Policy Models and critic network on the
+     * oldest collected rollout*/
+    centralised_ai::collective_robot_behaviour::PipelineStep step =
+        pipeline.Step();
+    centralised_ai::collective_robot_behaviour::RolloutStorage& rollout =
+        step.rollout;
+    torch::Tensor& losses = step.losses;
+
+    checkpointer.SaveIfDue([&]() {
+      trainer.SaveCheckpoint();
+
+      if (!fixed_point_directory.empty()) {
+        torch::Tensor calibration_states =
+            centralised_ai::collective_robot_behaviour::
+                ComputeCalibrationStates(rollout);
+        centralised_ai::collective_robot_behaviour::QuantizedPolicy
+            quantized_policy(policy, calibration_states);
+        quantized_policy.ExportSource(fixed_point_directory, "robot_policy");
+        std::cout << "Fixed point action agreement: "
+                  << centralised_ai::collective_robot_behaviour::
+                         ComputeActionAgreement(policy, quantized_policy,
+                                                calibration_states)
+                  << std::endl;
       }
-    }
+
+      if (quantized_rollouts) {
+        centralised_ai::collective_robot_behaviour::QuantizedInferenceReport
+            report = centralised_ai::collective_robot_behaviour::
+                EvaluateQuantizedInference(policy, critic, rollout);
+        std::cout << "Int8 action agreement: " << report.action_agreement
+                  << ", value error: " << report.value_error
+                  << ", agent steps/s: " << report.quantized_steps_per_second
+                  << " (float " << report.float_steps_per_second << ")"
+                  << std::endl;
+      }
+    });
+
+    /*Save the mean reward to a file*/
+    torch::Tensor rewards = rollout.GetRewards();
 
     centralised_ai::collective_robot_behaviour::SaveRewardToFile(
         rewards.mean(), epochs, reward_file_name);
@@ -121,8 +281,14 @@ int main() {
     centralised_ai::collective_robot_behaviour::SaveLossesToFile(
         losses, losses_file_name);
 
+    /* Save the latency percentiles of every phase in this epoch */
+    centralised_ai::collective_robot_behaviour::SavePhaseStatisticsToFile(
+        centralised_ai::collective_robot_behaviour::CollectPhaseStatistics(),
+        epochs, timings_file_name);
+
     /* Update the epoch index */
-    std::cout << "* Epochs: " << epochs << std::endl;
+    std::cout << "* Epochs: " << epochs << " (rollout " << step.staleness
+              << " updates stale)" << std::endl;
     epochs++;
   }
 
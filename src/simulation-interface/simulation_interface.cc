@@ -16,10 +16,12 @@
 #include "arpa/inet.h"
 #include "netinet/in.h"
 #include "sys/socket.h"
+#include "unistd.h"
 
 /* C++ standard library headers */
 #include "memory"
 #include "string"
+#include "utility"
 
 /* Project .h files */
 #include "../simulation-interface/generated/grsim_commands.pb.h"
@@ -50,6 +52,51 @@ SimulationInterface::SimulationInterface(std::string ip, uint16_t port,
   SetSpinnerOn(false);
 }
 
+/* Destructor */
+SimulationInterface::~SimulationInterface()
+{
+  if (socket_ >= 0)
+  {
+    ::close(socket_);
+  }
+}
+
+/* Move constructor */
+SimulationInterface::SimulationInterface(SimulationInterface&& other) noexcept
+    : socket_(-1)
+{
+  *this = std::move(other);
+}
+
+/* Move assignment */
+SimulationInterface& SimulationInterface::operator=(
+    SimulationInterface&& other) noexcept
+{
+  if (this != &other)
+  {
+    if (socket_ >= 0)
+    {
+      ::close(socket_);
+    }
+    socket_ = std::exchange(other.socket_, -1);
+    destination_ = other.destination_;
+    id_ = other.id_;
+    team_ = other.team_;
+    spinner_on_ = other.spinner_on_;
+    kicker_speed_ = other.kicker_speed_;
+    x_speed_ = other.x_speed_;
+    y_speed_ = other.y_speed_;
+    angular_speed_ = other.angular_speed_;
+    wheel_1_ = other.wheel_1_;
+    wheel_2_ = other.wheel_2_;
+    wheel_3_ = other.wheel_3_;
+    wheel_4_ = other.wheel_4_;
+    using_wheel_speed_ = other.using_wheel_speed_;
+  }
+
+  return *this;
+}
+
  /* Function for setting robot through robot id and team */
 void SimulationInterface::SetRobot(int id, enum Team team)
 {
@@ -95,13 +142,8 @@ void SimulationInterface::SetSpinnerOn(bool spinner_on)
 /* Send a UDP packet with the robot command */
 void SimulationInterface::SendPacket()
 {
-  GrSimPacket packet;
-
-  /* Write the data to the protobuf message */
-  packet = CreateProtoPacket();
-
-  /* Send the packet */
-  SendPacket(packet);
+  /* Write the data to the protobuf message and send it */
+  SendPacket(CreateProtoPacket());
 }
 
 GrSimPacket SimulationInterface::CreateProtoPacket()
@@ -130,7 +172,7 @@ GrSimPacket SimulationInterface::CreateProtoPacket()
 }
 
 /* Send a grSim packet with UDP */
-void SimulationInterface::SendPacket(GrSimPacket packet)
+void SimulationInterface::SendPacket(const GrSimPacket& packet)
 {
   size_t size;
   void *buffer;
@@ -38,7 +38,8 @@ namespace simulation_interface
  * in the simulation. Multiple robots can be controlled with multiple 
  * instantiations of this class.
  * 
- * @note not copyable, not moveable.
+ * @note Not copyable, moveable. The instance owns its socket and closes it
+ * when destroyed.
  */
 class SimulationInterface
 {
@@ -60,6 +61,31 @@ class SimulationInterface
    */
   SimulationInterface(std::string ip, uint16_t port, int id, enum Team team);
 
+  /*!
+   * @brief Destructor that closes the socket.
+   */
+  virtual ~SimulationInterface();
+
+  /*!
+   * @brief Move constructor that takes over the socket of another instance.
+   *
+   * @param[in] other The instance to move from, which no longer owns a
+   * socket afterwards.
+   */
+  SimulationInterface(SimulationInterface&& other) noexcept;
+
+  /*!
+   * @brief Move assignment that closes the own socket and takes over the
+   * socket of another instance.
+   *
+   * @param[in] other The instance to move from, which no longer owns a
+   * socket afterwards.
+   */
+  SimulationInterface& operator=(SimulationInterface&& other) noexcept;
+
+  SimulationInterface(const SimulationInterface&) = delete;
+  SimulationInterface& operator=(const SimulationInterface&) = delete;
+
   /*!
    * @brief Method to change robot to control with the class instance.
    *
@@ -156,7 +182,8 @@ class SimulationInterface
   /*********************/
 
   /*!
-   * @brief socket file descriptor.
+   * @brief socket file descriptor, -1 after the instance has been moved
+   * from.
    */
   int socket_;
 
@@ -238,7 +265,7 @@ class SimulationInterface
   /*!
    * @brief Send a grSim protobuf packet.
    */
-  void SendPacket(GrSimPacket packet);
+  void SendPacket(const GrSimPacket& packet);
 
   /*!
    * @brief Structure robot command into a grSim Protobuf packet.
@@ -0,0 +1,181 @@
+/* team_command_channel.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Interface that sends the commands of a whole team to grSim in
+ * one UDP packet
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* Related .h files */
+#include "../simulation-interface/team_command_channel.h"
+
+/* C system headers */
+#include "arpa/inet.h"
+#include "netinet/in.h"
+#include "sys/socket.h"
+#include "unistd.h"
+
+/* C++ standard library headers */
+#include "stdexcept"
+#include "string"
+#include "utility"
+#include "vector"
+
+/* Project .h files */
+#include "../simulation-interface/generated/grsim_commands.pb.h"
+#include "../simulation-interface/generated/grsim_packet.pb.h"
+#include "../common_types.h"
+
+namespace centralised_ai
+{
+namespace simulation_interface
+{
+
+/* Constructor */
+TeamCommandChannel::TeamCommandChannel(std::string ip, uint16_t port,
+    enum Team team, int robot_count)
+    : TeamCommandChannel(team, robot_count)
+{
+  /* Define destination address */
+  destination_.sin_family = AF_INET;
+  destination_.sin_port = htons(port);
+  destination_.sin_addr.s_addr = inet_addr(ip.c_str());
+
+  /* Create the client socket */
+  socket_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+}
+
+/* Constructor without socket */
+TeamCommandChannel::TeamCommandChannel(enum Team team, int robot_count)
+    : socket_(-1), destination_()
+{
+  GrSimRobotCommand *command;
+
+  /* Create one standing still command per robot */
+  packet_.mutable_commands()->set_is_team_yellow(team == Team::kYellow);
+  packet_.mutable_commands()->set_timestamp(0.0L);
+  for (int id = 0; id < robot_count; id++)
+  {
+    command = packet_.mutable_commands()->add_robot_commands();
+    command->set_id(id);
+    command->set_kick_speed_x(0.0F);
+    command->set_kick_speed_z(0.0F);
+    command->set_spinner(false);
+    command->set_wheels_speed(false);
+    command->set_vel_tangent(0.0F);
+    command->set_vel_normal(0.0F);
+    command->set_vel_angular(0.0F);
+  }
+}
+
+/* Destructor */
+TeamCommandChannel::~TeamCommandChannel()
+{
+  if (socket_ >= 0)
+  {
+    ::close(socket_);
+  }
+}
+
+/* Move constructor */
+TeamCommandChannel::TeamCommandChannel(TeamCommandChannel&& other) noexcept
+    : socket_(std::exchange(other.socket_, -1)),
+      destination_(other.destination_),
+      buffer_(std::move(other.buffer_)),
+      packet_(std::move(other.packet_))
+{
+}
+
+/* Move assignment */
+TeamCommandChannel& TeamCommandChannel::operator=(
+    TeamCommandChannel&& other) noexcept
+{
+  if (this != &other)
+  {
+    if (socket_ >= 0)
+    {
+      ::close(socket_);
+    }
+    socket_ = std::exchange(other.socket_, -1);
+    destination_ = other.destination_;
+    buffer_ = std::move(other.buffer_);
+    packet_ = std::move(other.packet_);
+  }
+
+  return *this;
+}
+
+/* Set the velocity of a robot in terms of x,y and angular speed */
+void TeamCommandChannel::SetVelocity(int id, float x_speed, float y_speed,
+    float angular_speed)
+{
+  GrSimRobotCommand *command = GetRobotCommand(id);
+
+  command->set_wheels_speed(false);
+  command->set_vel_tangent(x_speed);
+  command->set_vel_normal(y_speed);
+  command->set_vel_angular(angular_speed);
+}
+
+/* Set the velocity of a robot by setting the speed of its wheels */
+void TeamCommandChannel::SetVelocity(int id, float front_left_wheel_speed,
+    float back_left_wheel_speed,
+    float back_right_wheel_speed,
+    float front_right_wheel_speed)
+{
+  GrSimRobotCommand *command = GetRobotCommand(id);
+
+  command->set_wheels_speed(true);
+  command->set_wheel_1(-front_left_wheel_speed);
+  command->set_wheel_2(-back_left_wheel_speed);
+  command->set_wheel_3(back_right_wheel_speed);
+  command->set_wheel_4(front_right_wheel_speed);
+}
+
+/* Set the velocity of the kicker of a robot */
+void TeamCommandChannel::SetKickerSpeed(int id, float kicker_speed)
+{
+  GetRobotCommand(id)->set_kick_speed_x(kicker_speed);
+}
+
+/* Control the spinner of a robot */
+void TeamCommandChannel::SetSpinnerOn(int id, bool spinner_on)
+{
+  GetRobotCommand(id)->set_spinner(spinner_on);
+}
+
+/* The command of a robot, with the ID checked since the packet only holds
+ * commands for robot_count robots */
+GrSimRobotCommand *TeamCommandChannel::GetRobotCommand(int id)
+{
+  if (id < 0 || id >= packet_.commands().robot_commands_size())
+  {
+    throw std::invalid_argument("Robot ID out of range.");
+  }
+
+  return packet_.mutable_commands()->mutable_robot_commands(id);
+}
+
+/* Send one UDP packet with the commands of all robots */
+void TeamCommandChannel::SendPacket()
+{
+  size_t size;
+
+  /* Serialize into the kept buffer, which only grows if the packet does */
+  size = packet_.ByteSizeLong();
+  if (buffer_.size() < size)
+  {
+    buffer_.resize(size);
+  }
+  packet_.SerializeToArray(buffer_.data(), size);
+
+  /* Send the UDP packet */
+  ::sendto(socket_, buffer_.data(), size, 0,
+      reinterpret_cast<sockaddr *>(&destination_), sizeof(destination_));
+}
+
+} /* namespace simulation_interface */
+} /* namespace centralised_ai */
@@ -0,0 +1,217 @@
+/* team_command_channel.h
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Interface that sends the commands of a whole team to grSim in
+ * one UDP packet
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+#ifndef CENTRALISEDAI_SIMULATIONINTERFACE_TEAMCOMMANDCHANNEL_H_
+#define CENTRALISEDAI_SIMULATIONINTERFACE_TEAMCOMMANDCHANNEL_H_
+
+/* C system headers */
+#include "arpa/inet.h"
+#include "netinet/in.h"
+#include "sys/socket.h"
+
+/* C++ standard library headers */
+#include "string"
+#include "vector"
+
+/* Project .h files */
+#include "../simulation-interface/generated/grsim_commands.pb.h"
+#include "../simulation-interface/generated/grsim_packet.pb.h"
+#include "../common_types.h"
+
+namespace centralised_ai
+{
+namespace simulation_interface
+{
+
+/*!
+ * @brief Class for controlling all robots of one team in grSim.
+ *
+ * Holds the commands of every robot of a team in one grSim packet that is
+ * reused between calls, and sends them all with a single UDP packet. This
+ * way the commands of the whole team take effect in the same simulator step.
+ * Robot i of the channel is the robot with ID i in grSim.
+ *
+ * @note Not copyable, moveable. The instance owns its socket and closes it
+ * when destroyed.
+ */
+class TeamCommandChannel
+{
+ public:
+  /*!
+   * @brief Constructor that sets up connection to grSim for a team.
+   *
+   * @param[in] ip Ip address of the computer that is running grSim.
+   *
+   * @param[in] port The command listen port of grSim.
+   *
+   * @param[in] team Team color of the robots that are controlled.
+   *
+   * @param[in] robot_count Number of robots controlled, with IDs 0 to
+   * robot_count - 1.
+   */
+  TeamCommandChannel(std::string ip, uint16_t port, enum Team team,
+                     int robot_count = amount_of_players_in_team);
+
+  /*!
+   * @brief Destructor that closes the socket.
+   */
+  virtual ~TeamCommandChannel();
+
+  /*!
+   * @brief Move constructor that takes over the socket and commands of
+   * another instance.
+   *
+   * @param[in] other The instance to move from, which no longer owns a
+   * socket afterwards.
+   */
+  TeamCommandChannel(TeamCommandChannel&& other) noexcept;
+
+  /*!
+   * @brief Move assignment that closes the own socket and takes over the
+   * socket and commands of another instance.
+   *
+   * @param[in] other The instance to move from, which no longer owns a
+   * socket afterwards.
+   */
+  TeamCommandChannel& operator=(TeamCommandChannel&& other) noexcept;
+
+  TeamCommandChannel(const TeamCommandChannel&) = delete;
+  TeamCommandChannel& operator=(const TeamCommandChannel&) = delete;
+
+  /*!
+   * @brief Method to set the velocity of a robot in terms of x, y and angular
+   * speeds.
+   *
+   * @param[in] id ID of the robot.
+   *
+   * @param[in] x_speed The speed of the robot along the x axis in m/s.
+   *
+   * @param[in] y_speed The speed of the robot along the y axis in m/s.
+   *
+   * @param[in] angular_speed The angular speed of the robot in radians/s.
+   *
+   * @throws std::invalid_argument if id is not the ID of a controlled
+   * robot.
+   */
+  void SetVelocity(int id, float x_speed, float y_speed, float angular_speed);
+
+  /*!
+   * @brief Method to set the velocity of a robot by setting the speeds of the
+   * individual wheels.
+   *
+   * @param[in] id ID of the robot.
+   *
+   * @param[in] front_left_wheel_speed The speed of the front left wheel in
+   * m/s.
+   *
+   * @param[in] back_left_wheel_speed The speed of the back left wheel in m/s.
+   *
+   * @param[in] back_right_wheel_speed The speed of the back right wheel in
+   * m/s.
+   *
+   * @param[in] front_right_wheel_speed The speed of the front right wheel in
+   * m/s.
+   *
+   * @throws std::invalid_argument if id is not the ID of a controlled
+   * robot.
+   */
+  void SetVelocity(int id, float front_left_wheel_speed,
+                   float back_left_wheel_speed, float back_right_wheel_speed,
+                   float front_right_wheel_speed);
+
+  /*!
+   * @brief Method to set the velocity of the kicker of a robot.
+   *
+   * @param[in] id ID of the robot.
+   *
+   * @param[in] kicker_speed Set the speed of the kicker in m/s.
+   *
+   * @throws std::invalid_argument if id is not the ID of a controlled
+   * robot.
+   */
+  void SetKickerSpeed(int id, float kicker_speed);
+
+  /*!
+   * @brief Method to control the spinner of a robot.
+   *
+   * @param[in] id ID of the robot.
+   *
+   * @param[in] spinner_on Set wheter the spinner is on.
+   *
+   * @throws std::invalid_argument if id is not the ID of a controlled
+   * robot.
+   */
+  void SetSpinnerOn(int id, bool spinner_on);
+
+  /*!
+   * @brief Sends one UDP packet to grSim, carrying the commands of all
+   * robots.
+   *
+   * Needs to be called periodically in order for communication to be
+   * maintained, recommended minimum rate of 50Hz.
+   */
+  virtual void SendPacket();
+
+ protected:
+  /*!
+   * @brief Constructor for channels whose commands are not sent to grSim,
+   * such as to an in-process simulator. No socket is opened.
+   *
+   * @param[in] team Team color of the robots that are controlled.
+   *
+   * @param[in] robot_count Number of robots controlled.
+   */
+  TeamCommandChannel(enum Team team, int robot_count);
+
+  /*!
+   * @brief Returns the command of a robot in the packet.
+   *
+   * @param[in] id ID of the robot.
+   *
+   * @throws std::invalid_argument if id is not the ID of a controlled
+   * robot.
+   */
+  GrSimRobotCommand *GetRobotCommand(int id);
+
+  /*********************/
+  /* Network variables */
+  /*********************/
+
+  /*!
+   * @brief socket file descriptor, -1 after the instance has been moved
+   * from.
+   */
+  int socket_;
+
+  /*!
+   * @brief Address of grSim.
+   */
+  sockaddr_in destination_;
+
+  /*!
+   * @brief Buffer the packet is serialised into, kept between calls.
+   */
+  std::vector<char> buffer_;
+
+  /**************************/
+  /* Robot commands         */
+  /**************************/
+
+  /*!
+   * @brief Packet holding one robot command per robot, ordered by ID.
+   */
+  GrSimPacket packet_;
+};
+
+} /* namespace simulation_interface */
+} /* namesapce centralised_ai */
+
+#endif /* CENTRALISEDAI_SIMULATIONINTERFACE_TEAMCOMMANDCHANNEL_H_ */
@@ -106,14 +106,14 @@ void AutomatedReferee::RefereeStateHandler()
         yellow_team_score_++;
         referee_command_ = RefereeCommand::kPrepareKickoffBlue;
         prepare_kickoff_start_time_ = current_time;
-        ResetRobotsAndBall(grsim_ip_, grsim_port_, team_on_positive_half_);
+        ResetField();
       }
       else if (IsBallInGoal(Team::kYellow))
       {
         blue_team_score_++;
         referee_command_ = RefereeCommand::kPrepareKickoffYellow;
         prepare_kickoff_start_time_ = current_time;
-        ResetRobotsAndBall(grsim_ip_, grsim_port_, team_on_positive_half_);
+        ResetField();
       }
       else if (IsBallOutOfField(vision_client_.GetBallPositionX(),
           vision_client_.GetBallPositionY()))
@@ -169,6 +169,12 @@ void AutomatedReferee::StartGame(enum Team starting_team,
     referee_command_ = RefereeCommand::kPrepareKickoffYellow;
   }
   /* Reset robots and ball to initial positions. */
+  ResetField();
+}
+
+/* Reset robots and ball in grSim */
+void AutomatedReferee::ResetField()
+{
   ResetRobotsAndBall(grsim_ip_, grsim_port_, team_on_positive_half_);
 }
 
@@ -56,6 +56,12 @@ class AutomatedReferee
   AutomatedReferee(VisionClient& vision_client, std::string grsim_ip,
       uint16_t grsim_port);
 
+  /*!
+   * @brief Virtual destructor, as the way the field is reset can be
+   * overridden.
+   */
+  virtual ~AutomatedReferee() = default;
+
   /*!
    * @brief Analyze the game state, needs to be called continously.
    * 
@@ -301,37 +307,45 @@ class AutomatedReferee
   /*!
    * @brief Indicates positive half X-coordinate for goal.
    */
-  static constexpr float kGoalXPositiveHalf_ = 4500;
+  static constexpr float kGoalXPositiveHalf_ = kFieldHalfLength;
 
   /*!
    * @brief Indicates negative half X-coordinate for goal.
    */
-  static constexpr float kGoalXNegativeHalf_ = -4500;
+  static constexpr float kGoalXNegativeHalf_ = -kFieldHalfLength;
 
   /*!
    * @brief Indicates minimum Y-coordinate for goal width.
    */
-  static constexpr float kGoalWidthMinY_ = -500;
+  static constexpr float kGoalWidthMinY_ = -kGoalHalfWidth;
 
   /*!
    * @brief Indicates maximum Y-coordinate for goal width.
    */
-  static constexpr float kGoalWidthMaxY_ = 500;
+  static constexpr float kGoalWidthMaxY_ = kGoalHalfWidth;
 
   /*!
    * @brief Indicates maximum Y-coordinate for ball out of field.
    */
-  static constexpr float kBallOutOfFieldMaxY_ = 3000;
+  static constexpr float kBallOutOfFieldMaxY_ = kFieldHalfWidth;
 
   /*!
    * @brief Indicates minimum Y-coordinate for ball out of field.
    */
-  static constexpr float kBallOutOfFieldMinY_ = -3000;
+  static constexpr float kBallOutOfFieldMinY_ = -kFieldHalfWidth;
 
   /*********************/
   /* Protected methods */
   /*********************/
 
+  /*!
+   * @brief Resets robots and ball to their kickoff positions.
+   *
+   * Sends a replacement packet to grSim. Overridden when the game is played
+   * in another simulator.
+   */
+  virtual void ResetField();
+
   /*!
    * @brief Returns true if the ball is out of the field.
    *
@@ -30,16 +30,6 @@ namespace centralised_ai
 namespace ssl_interface
 {
 
-/* Initial positions of robots for both teams.
- * These are defined globally to avoid redundancy and ensure consistent starting
- * positions for both yellow and blue teams. For the blue team, the x-values
- * have opposite sign to place them on the opposite side of the field.
- */
-static constexpr double kInitialPositionX[6] =
-    {1.50, 1.50, 1.50, 0.55, 2.50, 3.60};
-static constexpr double kInitialPositionY[6] =
-    {1.12, 0.0, -1.12, 0.00, 0.00, 0.00};
-
 /* Send a grSim packet with UDP */
 static void SendPacket(GrSimPacket packet, std::string ip, uint16_t port)
 {
@@ -30,6 +30,20 @@ namespace centralised_ai
 namespace ssl_interface
 {
 
+/*!
+ * @brief Initial x positions in m of the robots of the team on the positive
+ * half of the field. The team on the negative half uses the same positions
+ * with opposite sign.
+ */
+static constexpr double kInitialPositionX[6] =
+    {1.50, 1.50, 1.50, 0.55, 2.50, 3.60};
+
+/*!
+ * @brief Initial y positions in m of the robots of both teams.
+ */
+static constexpr double kInitialPositionY[6] =
+    {1.12, 0.0, -1.12, 0.00, 0.00, 0.00};
+
 /*!
  * @brief Resets the position and attributes of all robots and the ball in grSim.
  * 
@@ -16,9 +16,17 @@
 #include "netinet/in.h"
 #include "stdio.h"
 #include "sys/socket.h" 
+#include "sys/time.h"
 
 /* C++ standard library headers */
+#include "atomic"
+#include "cstdint"
 #include "string" 
+#include "thread"
+#include "vector"
+
+/* Other .h files */
+#include "google/protobuf/arena.h"
 
 /* Project .h files */
 #include "../ssl-interface/generated/ssl_vision_detection.pb.h"
@@ -31,7 +39,7 @@ namespace ssl_interface
 {
 
 /* Constructor */
-VisionClient::VisionClient(std::string ip, int port)
+VisionClient::VisionClient(std::string ip, int port) : VisionClient()
 {
   /* Define client address */
   client_address_.sin_family = AF_INET;
@@ -46,24 +54,279 @@ VisionClient::VisionClient(std::string ip, int port)
       sizeof(client_address_));
 }
 
+/* Constructor without socket */
+VisionClient::VisionClient()
+    : client_address_(), socket_(-1), middle_frame_(1), back_frame_(2),
+      front_frame_(0), receive_in_background_(false),
+      drain_queued_packets_(false), known_cameras_(0), camera_packets_(),
+      received_packet_count_(0), discarded_packet_count_(0)
+{
+  /* Allocate the reused packet on the arena */
+  packet_ = google::protobuf::Arena::CreateMessage<SslWrapperPacket>(&arena_);
+
+  /* Start from an empty frame */
+  CopyFromFrame(VisionFrame());
+}
+
+/* Destructor */
+VisionClient::~VisionClient()
+{
+  StopBackgroundReceive();
+}
+
 /* Receive one UDP packet and write the data to the output parameter */
 void VisionClient::ReceivePacket()
 {
-  SslWrapperPacket packet;
   int message_length;
   char buffer[kMaxUdpPacketSize];
+  uint8_t middle;
+
+  if (receive_in_background_.load(std::memory_order_relaxed))
+  {
+    /* Swap in the latest published frame, if any arrived since last time */
+    if (middle_frame_.load(std::memory_order_relaxed) & kFreshFrameBit)
+    {
+      middle = middle_frame_.exchange(front_frame_, std::memory_order_acq_rel);
+      front_frame_ = middle & kFrameIndexMask;
+    }
+    CopyFromFrame(frames_[front_frame_]);
+    return;
+  }
+
+  if (drain_queued_packets_)
+  {
+    DrainPackets();
+    return;
+  }
 
   /* Receive raw packet */
   message_length = recv(socket_, buffer, kMaxUdpPacketSize,
       MSG_WAITALL);
 
+  /* Decode packet and read data from it */
   if (message_length > 0)
   {
-    /* Decode packet */
-    packet.ParseFromArray(buffer, message_length);
+    received_packet_count_.fetch_add(1, std::memory_order_relaxed);
+    if (ParsePacket(buffer, message_length))
+    {
+      ReadVisionData(*packet_);
+    }
+  }
+}
+
+/* Receive all queued packets and read the newest frame of each camera */
+void VisionClient::DrainPackets()
+{
+  int flags = MSG_WAITFORONE;
+  int received;
+
+  /* Point every recvmmsg slot to its part of the buffer */
+  if (drain_buffer_.empty())
+  {
+    drain_buffer_.resize(kDrainBatchSize * kDrainSlotSize);
+    for (int i = 0; i < kDrainBatchSize; i++)
+    {
+      drain_iovecs_[i].iov_base = &drain_buffer_[i * kDrainSlotSize];
+      drain_iovecs_[i].iov_len = kDrainSlotSize;
+      drain_messages_[i] = mmsghdr();
+      drain_messages_[i].msg_hdr.msg_iov = &drain_iovecs_[i];
+      drain_messages_[i].msg_hdr.msg_iovlen = 1;
+    }
+  }
+
+  /* Block until the first packet arrives, then take whatever else is queued
+   * without waiting. A full batch means more packets may be queued. */
+  do
+  {
+    received = recvmmsg(socket_, drain_messages_.data(), kDrainBatchSize,
+                        flags, nullptr);
+    if (received <= 0)
+    {
+      return;
+    }
+
+    received_packet_count_.fetch_add(received, std::memory_order_relaxed);
+    ReadNewestFrames(received);
+    flags = MSG_DONTWAIT;
+  }
+  while (received == kDrainBatchSize);
+}
+
+/* Read the newest detection frame of each camera among the received packets */
+void VisionClient::ReadNewestFrames(int count)
+{
+  uint32_t selected_cameras = 0;
+  uint32_t previous_cameras = known_cameras_;
+  int selected_order[kMaxCameras];
+  int selected_count = 0;
+  uint32_t camera;
+
+  /* Go from newest to oldest and keep the first frame of each camera */
+  for (int i = count - 1; i >= 0; i--)
+  {
+    const msghdr& header = drain_messages_[i].msg_hdr;
+
+    /* Once every camera seen in earlier drains has a frame, older packets
+     * are not parsed */
+    if (previous_cameras != 0 &&
+        (selected_cameras & previous_cameras) == previous_cameras)
+    {
+      discarded_packet_count_.fetch_add(i + 1, std::memory_order_relaxed);
+      break;
+    }
+
+    if ((header.msg_flags & MSG_TRUNC) ||
+        !ParsePacket(static_cast<const char*>(header.msg_iov->iov_base),
+                     drain_messages_[i].msg_len))
+    {
+      discarded_packet_count_.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+
+    /* Packets without a detection frame carry nothing that is read */
+    if (!packet_->has_detection())
+    {
+      continue;
+    }
 
-    /* Read data from packet */
-    ReadVisionData(packet);
+    camera = packet_->detection().camera_id();
+    if (camera >= kMaxCameras || (selected_cameras & (1u << camera)))
+    {
+      discarded_packet_count_.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+
+    /* Keep the parsed packet by swapping it with the camera's packet, both
+     * live on the same arena so this only exchanges pointers */
+    if (camera_packets_[camera] == nullptr)
+    {
+      camera_packets_[camera] =
+          google::protobuf::Arena::CreateMessage<SslWrapperPacket>(&arena_);
+    }
+    camera_packets_[camera]->Swap(packet_);
+
+    selected_cameras |= 1u << camera;
+    known_cameras_ |= 1u << camera;
+    selected_order[selected_count++] = camera;
+  }
+
+  /* Read the kept frames in the order they were received, so that the
+   * newest data wins where cameras overlap */
+  for (int i = selected_count - 1; i >= 0; i--)
+  {
+    ReadVisionData(*camera_packets_[selected_order[i]]);
+  }
+}
+
+/* Enable or disable draining of queued packets */
+void VisionClient::SetDrainQueuedPackets(bool drain)
+{
+  drain_queued_packets_ = drain;
+}
+
+/* Return the number of packets received */
+uint64_t VisionClient::GetReceivedPacketCount()
+{
+  return received_packet_count_.load();
+}
+
+/* Return the number of packets discarded when draining */
+uint64_t VisionClient::GetDiscardedPacketCount()
+{
+  return discarded_packet_count_.load();
+}
+
+/* Parse a raw UDP payload into the reused packet */
+bool VisionClient::ParsePacket(const char* buffer, int length)
+{
+  return packet_->ParseFromArray(buffer, length);
+}
+
+/* Start receiving packets on a separate thread */
+void VisionClient::StartBackgroundReceive()
+{
+  timeval timeout;
+
+  if (receive_in_background_.load())
+  {
+    return;
+  }
+
+  /* Let recv return periodically so that the thread notices when to stop */
+  timeout.tv_sec = 0;
+  timeout.tv_usec = 100000;
+  setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  /* Start every buffer from the data read so far */
+  for (VisionFrame& frame : frames_)
+  {
+    CopyToFrame(frame);
+  }
+  middle_frame_.store(1);
+  back_frame_ = 2;
+  front_frame_ = 0;
+
+  receive_in_background_.store(true);
+  receive_thread_ = std::thread(&VisionClient::ReceiveLoop, this);
+}
+
+/* Stop the thread started by StartBackgroundReceive */
+void VisionClient::StopBackgroundReceive()
+{
+  timeval timeout;
+
+  if (!receive_thread_.joinable())
+  {
+    return;
+  }
+
+  receive_in_background_.store(false);
+  receive_thread_.join();
+
+  /* Keep the latest frame and make recv block indefinitely again */
+  if (middle_frame_.load() & kFreshFrameBit)
+  {
+    front_frame_ = middle_frame_.exchange(front_frame_) & kFrameIndexMask;
+  }
+  CopyFromFrame(frames_[front_frame_]);
+  timeout.tv_sec = 0;
+  timeout.tv_usec = 0;
+  setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+}
+
+/* Return whether the background receive thread is running */
+bool VisionClient::IsReceivingInBackground()
+{
+  return receive_in_background_.load();
+}
+
+/* Body of the background receive thread */
+void VisionClient::ReceiveLoop()
+{
+  VisionFrame latest_frame = frames_[back_frame_];
+  int message_length;
+  char buffer[kMaxUdpPacketSize];
+  uint8_t middle;
+
+  while (receive_in_background_.load(std::memory_order_relaxed))
+  {
+    message_length = recv(socket_, buffer, kMaxUdpPacketSize, 0);
+
+    if (message_length > 0)
+    {
+      received_packet_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (message_length > 0 && ParsePacket(buffer, message_length))
+    {
+      /* Packets only carry the robots that are seen, so accumulate into the
+       * latest frame before publishing a copy of it */
+      ReadVisionData(*packet_, latest_frame);
+      frames_[back_frame_] = latest_frame;
+      middle = middle_frame_.exchange(back_frame_ | kFreshFrameBit,
+                                      std::memory_order_acq_rel);
+      back_frame_ = middle & kFrameIndexMask;
+    }
   }
 }
 
@@ -85,6 +348,12 @@ void VisionClient::ReceivePacketsUntilAllDataRead()
     ReceivePacket();
     all_data_has_been_read = true;
 
+    /* ReceivePacket does not wait for new data when receiving in background */
+    if (receive_in_background_.load(std::memory_order_relaxed))
+    {
+      std::this_thread::yield();
+    }
+
     for (int id = 0; id < amount_of_players_in_team; id++)
     {
       if (blue_robot_positions_read_[id] == false ||
@@ -101,31 +370,41 @@ void VisionClient::ReceivePacketsUntilAllDataRead()
 
 /* Read data from a protobuf defined packet from SSL-Vision and write it to this
  * object */
-void VisionClient::ReadVisionData(SslWrapperPacket packet)
+void VisionClient::ReadVisionData(const SslWrapperPacket& packet)
 {
-  SslDetectionFrame detection;
-  SslDetectionRobot robot;
-  SslDetectionBall ball;
+  VisionFrame frame;
+
+  CopyToFrame(frame);
+  ReadVisionData(packet, frame);
+  CopyFromFrame(frame);
+}
+
+/* Read data from a protobuf defined packet from SSL-Vision and write it to a
+ * frame */
+void VisionClient::ReadVisionData(const SslWrapperPacket& packet,
+                                  VisionFrame& frame)
+{
+  /* References into the packet, so that nothing is copied. The default
+   * instance is returned when there is no detection frame. */
+  const SslDetectionFrame& detection = packet.detection();
   int id;
 
   if (packet.has_detection())
   {
-    detection = packet.detection();
-
     /* Read positions of blue robots */
     for (int i = 0; i < detection.robots_blue_size(); ++i)
     {
-      robot = detection.robots_blue(i);
+      const SslDetectionRobot& robot = detection.robots_blue(i);
       id = robot.robot_id();
 
       if (id < amount_of_players_in_team)
       {
-        blue_robot_positions_x_[id] = robot.x();
-        blue_robot_positions_y_[id] = robot.y();
+        frame.blue_robot_positions_x[id] = robot.x();
+        frame.blue_robot_positions_y[id] = robot.y();
         if (robot.has_orientation())
         {
-          blue_robot_orientations_[id] = robot.orientation();
-          blue_robot_positions_read_[id] = true;
+          frame.blue_robot_orientations[id] = robot.orientation();
+          frame.blue_robot_positions_read[id] = true;
         }
       }
     }
@@ -133,17 +412,17 @@ void VisionClient::ReadVisionData(SslWrapperPacket packet)
     /* Read positions of yellow robots */
     for (int i = 0; i < detection.robots_yellow_size(); ++i)
     {
-      robot = detection.robots_yellow(i);
+      const SslDetectionRobot& robot = detection.robots_yellow(i);
       id = robot.robot_id();
 
       if (id < amount_of_players_in_team)
       {
-        yellow_robot_positions_x_[id] = robot.x();
-        yellow_robot_positions_y_[id] = robot.y();
+        frame.yellow_robot_positions_x[id] = robot.x();
+        frame.yellow_robot_positions_y[id] = robot.y();
         if (robot.has_orientation())
         {
-          yellow_robot_orientations_[id] = robot.orientation();
-          yellow_robot_positions_read_[id] = true;
+          frame.yellow_robot_orientations[id] = robot.orientation();
+          frame.yellow_robot_positions_read[id] = true;
         }
       }
     }
@@ -151,15 +430,55 @@ void VisionClient::ReadVisionData(SslWrapperPacket packet)
     /* Read ball position */
     if (detection.balls_size() > 0)
     {
-      ball = detection.balls(0);    // Assume only one ball is in play
-      ball_position_x_ = ball.x();
-      ball_position_y_ = ball.y();
-      ball_data_read_ = true;
+      const SslDetectionBall& ball = detection.balls(0); // Assume one ball
+      frame.ball_position_x = ball.x();
+      frame.ball_position_y = ball.y();
+      frame.ball_data_read = true;
     }
   }
 
   /* Get timestamp */
-  timestamp_ = detection.t_capture();
+  frame.timestamp = detection.t_capture();
+}
+
+/* Copy the data stored in this object into a frame */
+void VisionClient::CopyToFrame(VisionFrame& frame)
+{
+  frame.timestamp = timestamp_;
+  for (int id = 0; id < amount_of_players_in_team; id++)
+  {
+    frame.blue_robot_positions_x[id] = blue_robot_positions_x_[id];
+    frame.blue_robot_positions_y[id] = blue_robot_positions_y_[id];
+    frame.blue_robot_orientations[id] = blue_robot_orientations_[id];
+    frame.yellow_robot_positions_x[id] = yellow_robot_positions_x_[id];
+    frame.yellow_robot_positions_y[id] = yellow_robot_positions_y_[id];
+    frame.yellow_robot_orientations[id] = yellow_robot_orientations_[id];
+    frame.blue_robot_positions_read[id] = blue_robot_positions_read_[id];
+    frame.yellow_robot_positions_read[id] = yellow_robot_positions_read_[id];
+  }
+  frame.ball_position_x = ball_position_x_;
+  frame.ball_position_y = ball_position_y_;
+  frame.ball_data_read = ball_data_read_;
+}
+
+/* Overwrite the data stored in this object with a frame */
+void VisionClient::CopyFromFrame(const VisionFrame& frame)
+{
+  timestamp_ = frame.timestamp;
+  for (int id = 0; id < amount_of_players_in_team; id++)
+  {
+    blue_robot_positions_x_[id] = frame.blue_robot_positions_x[id];
+    blue_robot_positions_y_[id] = frame.blue_robot_positions_y[id];
+    blue_robot_orientations_[id] = frame.blue_robot_orientations[id];
+    yellow_robot_positions_x_[id] = frame.yellow_robot_positions_x[id];
+    yellow_robot_positions_y_[id] = frame.yellow_robot_positions_y[id];
+    yellow_robot_orientations_[id] = frame.yellow_robot_orientations[id];
+    blue_robot_positions_read_[id] = frame.blue_robot_positions_read[id];
+    yellow_robot_positions_read_[id] = frame.yellow_robot_positions_read[id];
+  }
+  ball_position_x_ = frame.ball_position_x;
+  ball_position_y_ = frame.ball_position_y;
+  ball_data_read_ = frame.ball_data_read;
 }
 
 /* Method to print position data, used for debugging/demo */
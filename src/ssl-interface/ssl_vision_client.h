@@ -18,7 +18,15 @@
 #include "sys/socket.h" 
 
 /* C++ standard library headers */
+#include "array"
+#include "atomic"
+#include "cstdint"
 #include "string" 
+#include "thread"
+#include "vector"
+
+/* Other .h files */
+#include "google/protobuf/arena.h"
 
 /* Project .h files */
 #include "../ssl-interface/generated/ssl_vision_detection.pb.h"
@@ -56,20 +64,91 @@ class VisionClient
    */
   VisionClient(std::string ip, int port);
 
+  /*!
+   * @brief Destructor that stops the background receive thread, if running.
+   */
+  virtual ~VisionClient();
+
   /*!
     * @brief Reads a UDP packet from ssl Vision.
     * 
    * Reads a UDP packet from ssl Vision, and updates all
    * game state values that are available in the client.
+   *
+   * When background receiving has been started with StartBackgroundReceive(),
+   * this method does not touch the socket. It instead takes the latest frame
+   * published by the receive thread, so that all Get* calls that follow see
+   * the same consistent frame.
    * 
-   * @warning This method is blocking until a UDP packet has been received,
-   * potentially introducing a delay in whatever other task the calling thread
-   * is doing. It is recommended to continously run this method in a thread
-   * separate from where the Get* functions are called.
+   * @warning Unless background receiving is active, this method is blocking
+   * until a UDP packet has been received, potentially introducing a delay in
+   * whatever other task the calling thread is doing.
    */
   virtual void ReceivePacket(); /* Set to virtual in order to mock 
                                  * receiving of packets when testing */
 
+  /*!
+   * @brief Starts receiving and parsing vision packets on a background
+   * thread.
+   *
+   * Starts a thread that continuously receives and parses packets from ssl
+   * Vision and publishes each resulting frame without locking. After this
+   * call ReceivePacket() no longer blocks. Calling this method when the
+   * thread is already running has no effect.
+   */
+  void StartBackgroundReceive();
+
+  /*!
+   * @brief Stops the background receive thread started by
+   * StartBackgroundReceive().
+   *
+   * Blocks until the thread has exited, which takes at most one receive
+   * timeout. Afterwards ReceivePacket() reads from the socket again.
+   */
+  void StopBackgroundReceive();
+
+  /*!
+   * @brief Returns whether packets are received on a background thread.
+   *
+   * @return True if StartBackgroundReceive() has been called and the thread
+   * has not been stopped.
+   */
+  bool IsReceivingInBackground();
+
+  /*!
+   * @brief Enables or disables draining of queued packets.
+   *
+   * In drain mode a blocking ReceivePacket() waits for at least one packet,
+   * then pulls every packet queued in the socket with as few recvmmsg calls
+   * as possible. Of these it only reads the newest detection frame of each
+   * camera, so that a caller that has fallen behind gets the newest data
+   * instead of the oldest queued packet. Has no effect while receiving in
+   * background.
+   *
+   * @param[in] drain True to enable drain mode, false to read one packet per
+   * call as before.
+   */
+  void SetDrainQueuedPackets(bool drain);
+
+  /*!
+   * @brief Returns the number of UDP packets received by this client.
+   *
+   * @return Number of packets received since construction.
+   */
+  uint64_t GetReceivedPacketCount();
+
+  /*!
+   * @brief Returns the number of received packets that were discarded in
+   * drain mode.
+   *
+   * Counts packets superseded by a newer detection frame of the same
+   * camera, whether or not they were parsed, as well as truncated and
+   * invalid packets.
+   *
+   * @return Number of packets discarded since construction.
+   */
+  uint64_t GetDiscardedPacketCount();
+
   /*!
    * @brief Prints the vision data that has been read by this client.
    * 
@@ -242,15 +321,213 @@ class VisionClient
    */
   bool ball_data_read_;
 
+  /*!
+   * @brief Arena owning the packet that incoming data is parsed into.
+   */
+  google::protobuf::Arena arena_;
+
+  /*!
+   * @brief Packet reused for every parse, allocated on arena_.
+   *
+   * Parsing into the same message keeps its nested detection frame and
+   * repeated robot entries, so after the first packets no more memory is
+   * allocated.
+   */
+  SslWrapperPacket* packet_;
+
+  /*!
+   * @brief Constructor for clients whose data does not come from ssl Vision,
+   * such as an in-process simulator. No socket is opened.
+   */
+  VisionClient();
+
+  /*****************************/
+  /* Background receive thread */
+  /*****************************/
+
+  /*!
+   * @brief Copy of all position data and time carried by the vision client.
+   *
+   * Used to hand complete frames from the background receive thread to the
+   * thread calling ReceivePacket().
+   */
+  struct VisionFrame
+  {
+    double timestamp;
+    float blue_robot_positions_x[amount_of_players_in_team];
+    float blue_robot_positions_y[amount_of_players_in_team];
+    float blue_robot_orientations[amount_of_players_in_team];
+    float yellow_robot_positions_x[amount_of_players_in_team];
+    float yellow_robot_positions_y[amount_of_players_in_team];
+    float yellow_robot_orientations[amount_of_players_in_team];
+    float ball_position_x;
+    float ball_position_y;
+    bool blue_robot_positions_read[amount_of_players_in_team];
+    bool yellow_robot_positions_read[amount_of_players_in_team];
+    bool ball_data_read;
+  };
+
+  /*!
+   * @brief Triple buffer of frames shared with the receive thread.
+   *
+   * The receive thread owns the buffer at index back_frame_, the caller of
+   * ReceivePacket() owns the buffer at index front_frame_ and the remaining
+   * buffer is exchanged through middle_frame_. Neither side ever waits for
+   * the other.
+   */
+  std::array<VisionFrame, 3> frames_;
+
+  /*!
+   * @brief Index of the shared buffer in the lower bits, and kFreshFrameBit
+   * set if it holds a frame that has not been taken yet.
+   */
+  std::atomic<uint8_t> middle_frame_;
+
+  /*!
+   * @brief Index of the buffer written by the receive thread.
+   */
+  uint8_t back_frame_;
+
+  /*!
+   * @brief Index of the buffer last taken by ReceivePacket().
+   */
+  uint8_t front_frame_;
+
+  /*!
+   * @brief Flag set in middle_frame_ when it holds an untaken frame.
+   */
+  static constexpr uint8_t kFreshFrameBit = 0x4;
+
+  /*!
+   * @brief Mask extracting the buffer index from middle_frame_.
+   */
+  static constexpr uint8_t kFrameIndexMask = 0x3;
+
+  /*!
+   * @brief Thread running ReceiveLoop().
+   */
+  std::thread receive_thread_;
+
+  /*!
+   * @brief Flag telling the receive thread to keep running.
+   */
+  std::atomic<bool> receive_in_background_;
+
+  /******************************/
+  /* Draining of queued packets */
+  /******************************/
+
+  /*!
+   * @brief Maximum number of packets received with one recvmmsg call.
+   */
+  static constexpr int kDrainBatchSize = 32;
+
+  /*!
+   * @brief Size of the buffer for each packet received by recvmmsg. Vision
+   * packets are a few kB, larger packets are truncated and discarded.
+   */
+  static constexpr int kDrainSlotSize = 16384;
+
+  /*!
+   * @brief Number of camera IDs that are tracked separately when draining.
+   */
+  static constexpr int kMaxCameras = 32;
+
+  /*!
+   * @brief Whether ReceivePacket() drains all queued packets.
+   */
+  bool drain_queued_packets_;
+
+  /*!
+   * @brief Bit mask of the camera IDs that detection frames have been
+   * received from.
+   */
+  uint32_t known_cameras_;
+
+  /*!
+   * @brief Receive buffers of all recvmmsg slots, allocated on first drain.
+   */
+  std::vector<char> drain_buffer_;
+
+  /*!
+   * @brief Buffer descriptors of all recvmmsg slots.
+   */
+  std::array<iovec, kDrainBatchSize> drain_iovecs_;
+
+  /*!
+   * @brief Message headers of all recvmmsg slots.
+   */
+  std::array<mmsghdr, kDrainBatchSize> drain_messages_;
+
+  /*!
+   * @brief Newest parsed packet of each camera in the current drain,
+   * allocated on arena_ when a camera is first seen.
+   */
+  std::array<SslWrapperPacket*, kMaxCameras> camera_packets_;
+
+  /*!
+   * @brief Number of packets received since construction.
+   */
+  std::atomic<uint64_t> received_packet_count_;
+
+  /*!
+   * @brief Number of packets discarded in drain mode since construction.
+   */
+  std::atomic<uint64_t> discarded_packet_count_;
+
   /**************************/
   /* Protected methods      */
   /**************************/
 
+  /*!
+   * @brief Parse a raw UDP payload into packet_.
+   *
+   * @return True if the payload is a valid packet.
+   */
+  bool ParsePacket(const char* buffer, int length);
+
   /*!
    * @brief Read the data from the protobuf data in the argument and store it
    * locally in the class instance.
    */
-  void ReadVisionData(SslWrapperPacket packet);
+  void ReadVisionData(const SslWrapperPacket& packet);
+
+  /*!
+   * @brief Read the data from the protobuf data in the argument into a
+   * frame, leaving values of robots and ball not in the packet unchanged.
+   */
+  static void ReadVisionData(const SslWrapperPacket& packet,
+                             VisionFrame& frame);
+
+  /*!
+   * @brief Copy the position data and time stored in this instance into a
+   * frame.
+   */
+  void CopyToFrame(VisionFrame& frame);
+
+  /*!
+   * @brief Overwrite the position data and time stored in this instance
+   * with the contents of a frame.
+   */
+  void CopyFromFrame(const VisionFrame& frame);
+
+  /*!
+   * @brief Receive and parse packets until receive_in_background_ is
+   * cleared, publishing a frame after each packet.
+   */
+  void ReceiveLoop();
+
+  /*!
+   * @brief Receive all queued packets and read the newest detection frame
+   * of each camera.
+   */
+  void DrainPackets();
+
+  /*!
+   * @brief Read the newest detection frame of each camera among the first
+   * count packets in the recvmmsg slots.
+   */
+  void ReadNewestFrames(int count);
 };
 
 } /* namespace ssl_interface */
@@ -0,0 +1,69 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the actor_learner_pipeline.cc and
+// actor_learner_pipeline.h file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <torch/torch.h>
+#include "../../src/collective-robot-behaviour/actor_learner_pipeline.h"
+#include "../../src/collective-robot-behaviour/mappo_trainer.h"
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/vectorized_runner.h"
+#include "../../src/common_types.h"
+#include "headless_game.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* No rollout is trained on more than max_staleness updates after the weights
+ * that collected it, and without staleness the loop is sequential */
+TEST(ActorLearnerPipelineTest, StalenessIsBounded)
+{
+  for (int64_t max_staleness : {0, 2})
+  {
+    PolicyNetwork policy = CreatePolicy();
+    CriticNetwork critic;
+    HeadlessGame game;
+    VectorizedRunner runner({game.GetEnvironment()}, Team::kBlue, 1);
+    MappoTrainer trainer(policy, critic);
+    ActorLearnerPipeline pipeline(runner, trainer, 1, max_staleness,
+        [&]() { game.StartGame(); });
+
+    pipeline.Start();
+    for (int update = 0; update < 4; update++)
+    {
+      PipelineStep step = pipeline.Step();
+
+      EXPECT_GE(step.staleness, 0);
+      EXPECT_LE(step.staleness, max_staleness);
+      EXPECT_EQ(step.rollout.NumEpisodes(), 1);
+      EXPECT_TRUE(step.losses.defined());
+    }
+    pipeline.Stop();
+  }
+}
+
+/* A failure on the collector thread reaches the learner */
+TEST(ActorLearnerPipelineTest, CollectorErrorIsRethrown)
+{
+  PolicyNetwork policy = CreatePolicy();
+  CriticNetwork critic;
+  HeadlessGame game;
+  VectorizedRunner runner({game.GetEnvironment()}, Team::kBlue, 1);
+  MappoTrainer trainer(policy, critic);
+  ActorLearnerPipeline pipeline(runner, trainer, 1, 1,
+      []() { throw std::runtime_error("grSim not reachable"); });
+
+  pipeline.Start();
+  EXPECT_THROW(pipeline.Step(), std::runtime_error);
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
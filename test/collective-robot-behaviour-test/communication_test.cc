@@ -30,6 +30,16 @@ public:
   void SetTimestamp (double value) {timestamp_ = value;}
 };
 
+/* Team command channel that counts sent packets instead of sending them. */
+class TeamCommandChannelDerived : public centralised_ai::simulation_interface::TeamCommandChannel
+{
+public:
+  TeamCommandChannelDerived(std::string ip, uint16_t port, Team team) : TeamCommandChannel(ip, port, team) {}
+  void SendPacket() override {sent_packets++;}
+  const GrSimPacket& GetPacket() {return packet_;}
+  int sent_packets = 0;
+};
+
 /* Mock class for AutomatedReferee. */
 class AutomatedRefereeDerived : public centralised_ai::ssl_interface::AutomatedReferee
 {
@@ -72,6 +82,36 @@ TEST(GetGlobalStateTest, TestShape)
 }
 
 
+TEST(ComputeLocalStatesTest, TestValues)
+{
+  /* Global state laid out as by GetGlobalState. */
+  torch::Tensor state = torch::zeros({1, 1, num_global_states});
+  state[0][0][1] = 12.0F;
+  state[0][0][2] = -34.0F;
+  for (int id = 0; id < centralised_ai::amount_of_players_in_team; id++)
+  {
+    state[0][0][3 + 2 * id] = 100.0F * id;
+    state[0][0][4 + 2 * id] = -50.0F * id;
+    state[0][0][15 + id] = 0.1F * id;
+  }
+
+  torch::Tensor local_states = ComputeLocalStates(state);
+
+  EXPECT_EQ(local_states.size(0), 1);
+  EXPECT_EQ(local_states.size(1), 1);
+  EXPECT_EQ(local_states.size(2), centralised_ai::amount_of_players_in_team);
+  EXPECT_EQ(local_states.size(3), num_local_states);
+
+  for (int id = 0; id < centralised_ai::amount_of_players_in_team; id++)
+  {
+    EXPECT_FLOAT_EQ(local_states[0][0][id][0].item<float>(), 100.0F * id);
+    EXPECT_FLOAT_EQ(local_states[0][0][id][1].item<float>(), -50.0F * id);
+    EXPECT_FLOAT_EQ(local_states[0][0][id][2].item<float>(), 0.1F * id);
+    EXPECT_FLOAT_EQ(local_states[0][0][id][3].item<float>(), 12.0F);
+    EXPECT_FLOAT_EQ(local_states[0][0][id][4].item<float>(), -34.0F);
+  }
+}
+
 TEST(ComputeOpponentTeamTest, TestOpponentTeam_1)
 {
     Team own_team = Team::kBlue;
@@ -90,5 +130,22 @@ TEST(ComputeOpponentTeamTest, TestOpponentTeam_2)
     EXPECT_EQ(opponent_team, Team::kBlue);
 }
 
+TEST(SendActionsTest, SendsOnePacketForTeam)
+{
+  TeamCommandChannelDerived channel("127.0.0.1", 20011, Team::kBlue);
+  torch::Tensor action_ids = torch::tensor({0, 1, 2, 3, 4, 5});
+
+  SendActions(channel, action_ids);
+
+  EXPECT_EQ(channel.sent_packets, 1);
+  const GrSimCommands& commands = channel.GetPacket().commands();
+  EXPECT_FLOAT_EQ(commands.robot_commands(0).vel_tangent(), 0.5F);
+  EXPECT_FLOAT_EQ(commands.robot_commands(1).vel_tangent(), -0.5F);
+  EXPECT_FLOAT_EQ(commands.robot_commands(2).vel_normal(), 0.5F);
+  EXPECT_FLOAT_EQ(commands.robot_commands(3).vel_normal(), -0.5F);
+  EXPECT_FLOAT_EQ(commands.robot_commands(4).vel_angular(), 1.0F);
+  EXPECT_FLOAT_EQ(commands.robot_commands(5).vel_angular(), -1.0F);
+}
+
 }
 }
\ No newline at end of file
@@ -0,0 +1,158 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the dynamic_quantization.cc and
+// dynamic_quantization.h file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <gtest/gtest.h>
+#include <torch/torch.h>
+#include <tuple>
+#include <vector>
+#include "../../src/collective-robot-behaviour/dynamic_quantization.h"
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/policy_runner.h"
+#include "../../src/common_types.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Uniform values in [-kRange, kRange] for every column */
+static torch::Tensor UniformStates(int64_t batch,
+    const std::vector<float>& kRanges)
+{
+  torch::Tensor ranges = torch::tensor(kRanges);
+  return (2 * torch::rand({batch, ranges.size(0)}) - 1) * ranges;
+}
+
+/* Local states at the scale the robots see them: positions in mm on the
+ * field and orientations in radians */
+static torch::Tensor RealisticLocalStates(int64_t batch)
+{
+  return UniformStates(batch, {4500, 3000, 3.14159F, 4500, 3000});
+}
+
+/* Global states at the same scale: the game state, the ball position, the
+ * robot positions and the robot orientations */
+static torch::Tensor RealisticGlobalStates(int64_t batch)
+{
+  std::vector<float> ranges = {1, 4500, 3000};
+  for (int id = 0; id < amount_of_players_in_team; id++)
+  {
+    ranges.push_back(4500);
+    ranges.push_back(3000);
+  }
+  for (int id = 0; id < amount_of_players_in_team; id++)
+  {
+    ranges.push_back(3.14159F);
+  }
+  return UniformStates(batch, ranges);
+}
+
+/* A quantized Linear layer gives the float outputs within the resolution of
+ * its int8 weights and inputs */
+TEST(DynamicQuantizationTest, LinearMatchesFloat)
+{
+  torch::manual_seed(0);
+  torch::nn::Linear linear(hidden_size, hidden_size);
+  DynamicQuantizedLinear quantized_linear(linear);
+  torch::Tensor input = torch::randn({8, hidden_size});
+
+  torch::NoGradGuard no_grad;
+  EXPECT_TRUE(torch::allclose(quantized_linear.Forward(input),
+                              linear->forward(input), 0, 0.05));
+}
+
+/* One time step of the quantized policy gives the logits and hidden states
+ * of PolicyNetwork::Forward, and nearly always the same action */
+TEST(DynamicQuantizationTest, PolicyMatchesForward)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  DynamicQuantizedPolicy quantized_policy(policy);
+  const int64_t kNumAgents = 200;
+  torch::Tensor local_states = RealisticLocalStates(kNumAgents);
+  torch::Tensor hidden_states = 0.5 * torch::randn({kNumAgents, hidden_size});
+
+  torch::NoGradGuard no_grad;
+  std::tuple<torch::Tensor, torch::Tensor> expected =
+      policy.Forward(local_states.unsqueeze(0), hidden_states.unsqueeze(0));
+  std::tuple<torch::Tensor, torch::Tensor> quantized =
+      quantized_policy.Forward(local_states, hidden_states);
+
+  torch::Tensor expected_logits = std::get<0>(expected).squeeze(0);
+  EXPECT_TRUE(torch::allclose(std::get<0>(quantized), expected_logits, 0,
+                              0.05));
+  EXPECT_TRUE(torch::allclose(std::get<1>(quantized),
+                              std::get<1>(expected).squeeze(0), 0, 0.05));
+
+  double agreement = std::get<0>(quantized)
+                         .argmax(1)
+                         .eq(expected_logits.argmax(1))
+                         .to(torch::kDouble)
+                         .mean()
+                         .item<double>();
+  EXPECT_GE(agreement, 0.9);
+}
+
+/* One time step of the quantized critic gives the values and hidden states
+ * of CriticNetwork::Forward */
+TEST(DynamicQuantizationTest, CriticMatchesForward)
+{
+  torch::manual_seed(0);
+  CriticNetwork critic;
+  DynamicQuantizedCritic quantized_critic(critic);
+  torch::Tensor global_states = RealisticGlobalStates(16);
+  torch::Tensor hidden_states = 0.5 * torch::randn({16, hidden_size});
+
+  torch::NoGradGuard no_grad;
+  std::tuple<torch::Tensor, torch::Tensor> expected =
+      critic.Forward(global_states.unsqueeze(0), hidden_states.unsqueeze(0));
+  std::tuple<torch::Tensor, torch::Tensor> quantized =
+      quantized_critic.Forward(global_states, hidden_states);
+
+  /* The ReLU outputs grow with the raw states, so the int8 layers after it
+   * are only accurate relative to the size of the values */
+  EXPECT_TRUE(torch::allclose(std::get<0>(quantized),
+                              std::get<0>(expected).reshape({16, 1}), 0.05,
+                              0.05));
+  EXPECT_TRUE(torch::allclose(std::get<1>(quantized),
+                              std::get<1>(expected).squeeze(0), 0, 0.05));
+}
+
+/* A PolicyRunner on a quantized policy carries the hidden states of
+ * DynamicQuantizedPolicy::Forward from one time step to the next */
+TEST(DynamicQuantizationTest, PolicyRunnerMatchesQuantizedForward)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  DynamicQuantizedPolicy quantized_policy(policy);
+  const int64_t kNumAgents = 2 * amount_of_players_in_team;
+  PolicyRunner runner(quantized_policy, kNumAgents);
+
+  torch::NoGradGuard no_grad;
+  torch::Tensor hidden_states = torch::zeros({kNumAgents, hidden_size});
+  for (int t = 0; t < 3; t++)
+  {
+    torch::Tensor local_states = RealisticLocalStates(kNumAgents);
+    std::tuple<torch::Tensor, torch::Tensor> expected =
+        quantized_policy.Forward(local_states, hidden_states);
+    torch::Tensor probabilities = torch::softmax(std::get<0>(expected), 1);
+    hidden_states = std::get<1>(expected);
+
+    std::tuple<torch::Tensor, torch::Tensor> actions =
+        runner.Act(local_states);
+
+    EXPECT_TRUE(torch::equal(std::get<0>(actions), probabilities.argmax(1)));
+    EXPECT_TRUE(torch::allclose(runner.GetProbabilities(), probabilities,
+                                1e-4, 1e-6));
+    EXPECT_TRUE(torch::allclose(runner.GetHiddenStates(), hidden_states));
+  }
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,53 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: In-process game shared by the tests that collect rollouts
+// from the headless simulator.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#ifndef CENTRALISEDAI_TEST_COLLECTIVEROBOTBEHAVIOURTEST_HEADLESSGAME_H_
+#define CENTRALISEDAI_TEST_COLLECTIVEROBOTBEHAVIOURTEST_HEADLESSGAME_H_
+
+#include "../../src/collective-robot-behaviour/vectorized_runner.h"
+#include "../../src/common_types.h"
+#include "../../src/headless-simulation/headless_simulator.h"
+#include "../../src/headless-simulation/simulated_command_channel.h"
+#include "../../src/headless-simulation/simulated_referee.h"
+#include "../../src/headless-simulation/simulated_vision_client.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* The interfaces of one in-process game, with the game started */
+struct HeadlessGame
+{
+  headless_simulation::HeadlessSimulator simulator;
+  headless_simulation::SimulatedVisionClient vision_client{simulator};
+  headless_simulation::SimulatedReferee referee{vision_client, simulator};
+  headless_simulation::SimulatedCommandChannel command_channel{simulator,
+      Team::kBlue};
+
+  HeadlessGame()
+  {
+    StartGame();
+  }
+
+  void StartGame()
+  {
+    referee.StartGame(Team::kBlue, Team::kYellow, 3.0F, 300);
+  }
+
+  Environment GetEnvironment()
+  {
+    return {referee, vision_client, command_channel};
+  }
+};
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_TEST_COLLECTIVEROBOTBEHAVIOURTEST_HEADLESSGAME_H_ */
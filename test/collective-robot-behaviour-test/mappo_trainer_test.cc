@@ -0,0 +1,288 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the mappo_trainer.cc and mappo_trainer.h
+// file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <torch/torch.h>
+#include <vector>
+#include "../../src/collective-robot-behaviour/mappo_trainer.h"
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/rollout_storage.h"
+#include "../../src/common_types.h"
+#include "random_rollout.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Trainer that exposes its optimizers */
+class TestMappoTrainer : public MappoTrainer
+{
+ public:
+  using MappoTrainer::MappoTrainer;
+  using MappoTrainer::policy_optimizer_;
+  using MappoTrainer::critic_optimizer_;
+};
+
+/* A rollout of two chunks per episode */
+static RolloutStorage CreateRollout(int64_t num_episodes)
+{
+  return CreateRandomRollout(num_episodes, 2 * chunk_length);
+}
+
+/* Without a KL target every update takes epochs * mini batches steps with the
+ * same optimizers, whose state is kept from one update to the next */
+TEST(MappoTrainerTest, OptimizerStatePersistsAcrossUpdates)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  CriticNetwork critic;
+  TestMappoTrainer trainer(policy, critic, 2, 3, 0.0);
+  RolloutStorage rollout = CreateRollout(2);
+
+  std::vector<torch::Tensor> initial_parameters;
+  for (const torch::Tensor& kParameter : policy.parameters())
+  {
+    initial_parameters.push_back(kParameter.detach().clone());
+  }
+
+  torch::Tensor losses = trainer.Update(rollout);
+  EXPECT_EQ(losses.numel(), 2);
+  EXPECT_EQ(trainer.NumOptimizerSteps(), 6);
+  EXPECT_EQ(trainer.GetEpochStatistics().size(), 2u);
+  EXPECT_EQ(trainer.policy_optimizer_.state().size(),
+      policy.parameters().size());
+  EXPECT_EQ(trainer.critic_optimizer_.state().size(),
+      critic.parameters().size());
+
+  trainer.Update(rollout);
+  EXPECT_EQ(trainer.NumOptimizerSteps(), 12);
+
+  /* Adam counts every step it has taken on each parameter */
+  for (const auto& kState : trainer.policy_optimizer_.state())
+  {
+    const auto& kAdamState =
+        static_cast<const torch::optim::AdamParamState&>(*kState.second);
+    EXPECT_EQ(kAdamState.step(), 12);
+  }
+
+  std::vector<torch::Tensor> parameters = policy.parameters();
+  for (size_t i = 0; i < parameters.size(); i++)
+  {
+    EXPECT_FALSE(parameters[i].equal(initial_parameters[i]));
+  }
+}
+
+/* The statistics of every pass are reported, and a pass above the KL target
+ * ends the update */
+TEST(MappoTrainerTest, StopsEarlyAboveKlTarget)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  CriticNetwork critic;
+
+  /* The rollout was collected with uniform probabilities, which the random
+   * policy does not have, so the first pass is already above the target */
+  MappoTrainer trainer(policy, critic, 5, 2, 1e-9);
+  trainer.Update(CreateRollout(2));
+
+  ASSERT_EQ(trainer.GetEpochStatistics().size(), 1u);
+  EXPECT_EQ(trainer.NumOptimizerSteps(), 2);
+
+  const EpochStatistics& kStatistics = trainer.GetEpochStatistics()[0];
+  EXPECT_GT(kStatistics.approximate_kl, 1e-9);
+  EXPECT_GE(kStatistics.clip_fraction, 0.0);
+  EXPECT_LE(kStatistics.clip_fraction, 1.0);
+}
+
+/* The debug checks do not change what is trained */
+TEST(MappoTrainerTest, DebugModeTrainsAsReleaseMode)
+{
+  torch::manual_seed(0);
+  RolloutStorage rollout = CreateRollout(2);
+
+  PolicyNetwork release_policy = CreatePolicy();
+  CriticNetwork release_critic;
+  PolicyNetwork debug_policy = CreatePolicy();
+  CriticNetwork debug_critic;
+  CopyParameters(release_policy, debug_policy);
+  CopyParameters(release_critic, debug_critic);
+
+  MappoTrainer release_trainer(release_policy, release_critic, 1, 1, 0.0);
+  MappoTrainer debug_trainer(debug_policy, debug_critic, 1, 1, 0.0);
+  debug_trainer.SetTrainingMode(TrainingMode::kDebug);
+
+  /* One mini batch holds every chunk, so the shuffle does not matter */
+  release_trainer.Update(rollout);
+  debug_trainer.Update(rollout);
+
+  std::vector<torch::Tensor> release_parameters = release_policy.parameters();
+  std::vector<torch::Tensor> debug_parameters = debug_policy.parameters();
+  for (size_t i = 0; i < release_parameters.size(); i++)
+  {
+    EXPECT_TRUE(torch::allclose(release_parameters[i], debug_parameters[i],
+        1e-5, 1e-6));
+  }
+}
+
+/* A NaN loss stops a debug update */
+TEST(MappoTrainerTest, DebugModeThrowsOnNanLoss)
+{
+  torch::manual_seed(0);
+  RolloutStorage rollout = CreateRollout(2);
+  rollout.GetRewards()[0][0].fill_(NAN);
+  rollout.ComputeReturns(0, 0.99, 0.95);
+
+  PolicyNetwork policy = CreatePolicy();
+  CriticNetwork critic;
+  MappoTrainer trainer(policy, critic, 1, 1, 0.0);
+  trainer.SetTrainingMode(TrainingMode::kDebug);
+
+  EXPECT_THROW(trainer.Update(rollout), std::runtime_error);
+}
+
+/* The gradients of all parameters of a network, as one vector */
+static torch::Tensor FlattenGradients(const torch::nn::Module& kNetwork)
+{
+  std::vector<torch::Tensor> gradients;
+  for (const torch::Tensor& kParameter : kNetwork.parameters())
+  {
+    gradients.push_back(kParameter.grad().flatten());
+  }
+
+  return torch::cat(gradients);
+}
+
+/* How far the parameters of a network moved from a copy of their initial
+ * values, as one vector */
+static torch::Tensor FlattenChanges(const torch::nn::Module& kNetwork,
+                                    const torch::nn::Module& kInitial)
+{
+  std::vector<torch::Tensor> changes;
+  std::vector<torch::Tensor> initial_parameters = kInitial.parameters();
+  std::vector<torch::Tensor> parameters = kNetwork.parameters();
+  for (size_t i = 0; i < parameters.size(); i++)
+  {
+    changes.push_back((parameters[i] - initial_parameters[i]).flatten());
+  }
+
+  return torch::cat(changes).detach();
+}
+
+/* Cosine of the angle between two vectors */
+static double ComputeCosineSimilarity(const torch::Tensor& kFirst,
+                                      const torch::Tensor& kSecond)
+{
+  return torch::cosine_similarity(kFirst, kSecond, 0).item<double>();
+}
+
+/* The gradients of the first step in bfloat16 agree with the float32 ones
+ * within the 8 bit mantissa of bfloat16, accumulated over the layers */
+TEST(MappoTrainerTest, BFloat16GradientsMatchFloat32)
+{
+  torch::manual_seed(0);
+  RolloutStorage rollout = CreateRollout(4);
+
+  PolicyNetwork float_policy = CreatePolicy();
+  CriticNetwork float_critic;
+  PolicyNetwork bf16_policy = CreatePolicy();
+  CriticNetwork bf16_critic;
+  CopyParameters(float_policy, bf16_policy);
+  CopyParameters(float_critic, bf16_critic);
+
+  /* One step on one mini batch of every chunk, whose gradients are kept in
+   * the parameters after the step */
+  MappoTrainer float_trainer(float_policy, float_critic, 1, 1, 0.0);
+  MappoTrainer bf16_trainer(bf16_policy, bf16_critic, 1, 1, 0.0);
+  bf16_trainer.SetTrainingPrecision(TrainingPrecision::kBFloat16);
+  float_trainer.Update(rollout);
+  bf16_trainer.Update(rollout);
+
+  std::vector<torch::Tensor> float_gradients = {
+      FlattenGradients(float_policy), FlattenGradients(float_critic)};
+  std::vector<torch::Tensor> bf16_gradients = {
+      FlattenGradients(bf16_policy), FlattenGradients(bf16_critic)};
+  for (size_t i = 0; i < float_gradients.size(); i++)
+  {
+    EXPECT_EQ(bf16_gradients[i].scalar_type(), torch::kFloat);
+    double tolerance =
+        0.05 * float_gradients[i].abs().max().item<double>();
+    EXPECT_TRUE(torch::allclose(bf16_gradients[i], float_gradients[i], 0.05,
+        tolerance));
+    EXPECT_GE(ComputeCosineSimilarity(bf16_gradients[i], float_gradients[i]),
+        0.99);
+  }
+}
+
+/* From the same seed, training in bfloat16 follows the float32 run: the
+ * losses of every update agree, and both networks move in nearly the same
+ * direction from their initial parameters */
+TEST(MappoTrainerTest, BFloat16TrainsAsFloat32)
+{
+  torch::manual_seed(0);
+  RolloutStorage rollout = CreateRollout(4);
+
+  PolicyNetwork initial_policy = CreatePolicy();
+  CriticNetwork initial_critic;
+  PolicyNetwork float_policy = CreatePolicy();
+  CriticNetwork float_critic;
+  PolicyNetwork bf16_policy = CreatePolicy();
+  CriticNetwork bf16_critic;
+  CopyParameters(initial_policy, float_policy);
+  CopyParameters(initial_critic, float_critic);
+  CopyParameters(initial_policy, bf16_policy);
+  CopyParameters(initial_critic, bf16_critic);
+
+  MappoTrainer float_trainer(float_policy, float_critic, 2, 2, 0.0);
+  MappoTrainer bf16_trainer(bf16_policy, bf16_critic, 2, 2, 0.0);
+  bf16_trainer.SetTrainingPrecision(TrainingPrecision::kBFloat16);
+
+  const int kNumUpdates = 5;
+  std::vector<torch::Tensor> float_losses;
+  std::vector<torch::Tensor> bf16_losses;
+  for (int update = 0; update < kNumUpdates; update++)
+  {
+    /* The same shuffle of the chunks for both */
+    torch::manual_seed(update);
+    float_losses.push_back(float_trainer.Update(rollout));
+    torch::manual_seed(update);
+    bf16_losses.push_back(bf16_trainer.Update(rollout));
+  }
+
+  for (int update = 0; update < kNumUpdates; update++)
+  {
+    EXPECT_TRUE(torch::allclose(bf16_losses[update], float_losses[update],
+        0.05, 0.01));
+  }
+
+  for (const torch::Tensor& kParameter : bf16_policy.parameters())
+  {
+    EXPECT_EQ(kParameter.scalar_type(), torch::kFloat);
+  }
+
+  /* Adam moves every parameter by about learning_rate per step whatever the
+   * size of its gradient, so this compares directions, not distances */
+  torch::Tensor float_policy_changes =
+      FlattenChanges(float_policy, initial_policy);
+  torch::Tensor bf16_policy_changes =
+      FlattenChanges(bf16_policy, initial_policy);
+  torch::Tensor float_critic_changes =
+      FlattenChanges(float_critic, initial_critic);
+  torch::Tensor bf16_critic_changes =
+      FlattenChanges(bf16_critic, initial_critic);
+  EXPECT_GE(ComputeCosineSimilarity(bf16_policy_changes,
+      float_policy_changes), 0.95);
+  EXPECT_GE(ComputeCosineSimilarity(bf16_critic_changes,
+      float_critic_changes), 0.95);
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -62,9 +62,104 @@ TEST(UpdateNetwork, Update) {
   }
 }
 
+TEST(ForwardSequence, PolicyMatchesStepwiseForward) {
+  auto policy = CreatePolicy();
+  int64_t num_time_steps = 10;
+  int64_t batch = 4;
+
+  auto input = torch::randn({num_time_steps, batch, num_local_states});
+  auto h0 = torch::randn({1, batch, hidden_size});
+
+  auto [sequence_output, sequence_hx] = policy.ForwardSequence(input, h0);
+  EXPECT_EQ(sequence_output.size(0), num_time_steps);
+  EXPECT_EQ(sequence_output.size(1), batch);
+  EXPECT_EQ(sequence_output.size(2), num_actions);
+
+  // Every sequence in the batch must match stepping Forward one step at a time
+  for (int64_t b = 0; b < batch; ++b) {
+    auto hx = h0.slice(1, b, b + 1);
+    for (int64_t t = 0; t < num_time_steps; ++t) {
+      auto [output, new_hx] =
+          policy.Forward(input[t][b].view({1, 1, num_local_states}), hx);
+      hx = new_hx;
+      EXPECT_TRUE(torch::allclose(output.squeeze(), sequence_output[t][b],
+                                  1e-5, 1e-6));
+    }
+    EXPECT_TRUE(torch::allclose(hx.squeeze(), sequence_hx[0][b], 1e-5, 1e-6));
+  }
+}
+
+TEST(ForwardSequence, CriticMatchesStepwiseForward) {
+  CriticNetwork critic_network;
+  int64_t num_time_steps = 10;
+  int64_t batch = 3;
+
+  auto input = torch::randn({num_time_steps, batch, num_global_states});
+  auto h0 = torch::randn({1, batch, hidden_size});
+
+  auto [sequence_output, sequence_hx] =
+      critic_network.ForwardSequence(input, h0);
+  EXPECT_EQ(sequence_output.size(0), num_time_steps);
+  EXPECT_EQ(sequence_output.size(1), batch);
+  EXPECT_EQ(sequence_output.size(2), 1);
+
+  for (int64_t b = 0; b < batch; ++b) {
+    auto hx = h0.slice(1, b, b + 1);
+    for (int64_t t = 0; t < num_time_steps; ++t) {
+      auto [output, new_hx] = critic_network.Forward(
+          input[t][b].view({1, 1, num_global_states}), hx);
+      hx = new_hx;
+      EXPECT_TRUE(torch::allclose(output.squeeze(),
+                                  sequence_output[t][b].squeeze(), 1e-5,
+                                  1e-6));
+    }
+    EXPECT_TRUE(torch::allclose(hx.squeeze(), sequence_hx[0][b], 1e-5, 1e-6));
+  }
+}
+
+TEST(CopyParameters, CopiesAllParameters) {
+  auto source = CreatePolicy();
+  auto target = CreatePolicy();
+
+  CopyParameters(source, target);
 
+  auto source_params = source.parameters();
+  auto target_params = target.parameters();
+  ASSERT_EQ(source_params.size(), target_params.size());
+  for (size_t i = 0; i < source_params.size(); ++i) {
+    EXPECT_TRUE(source_params[i].equal(target_params[i]));
+    // A copy, not shared storage
+    EXPECT_NE(source_params[i].data_ptr(), target_params[i].data_ptr());
+  }
+  EXPECT_TRUE(target_params[0].requires_grad());
+}
 
+TEST(CopyParameters, CopiesTensorList) {
+  auto source = CreatePolicy();
+  auto target = CreatePolicy();
 
+  std::vector<torch::Tensor> snapshot;
+  for (const auto& param : source.parameters()) {
+    snapshot.push_back(param.detach().clone());
+  }
+  CopyParameters(snapshot, target);
+
+  auto target_params = target.parameters();
+  ASSERT_EQ(snapshot.size(), target_params.size());
+  for (size_t i = 0; i < snapshot.size(); ++i) {
+    EXPECT_TRUE(snapshot[i].equal(target_params[i]));
+  }
+}
+
+TEST(Checkpointer, SavesAtMostOncePerInterval) {
+  Checkpointer checkpointer(std::chrono::hours(1));
+  int saves = 0;
+  auto save = [&saves]() { ++saves; };
+
+  EXPECT_TRUE(checkpointer.SaveIfDue(save));
+  EXPECT_FALSE(checkpointer.SaveIfDue(save));
+  EXPECT_EQ(saves, 1);
+}
 
 }
 }
\ No newline at end of file
@@ -0,0 +1,138 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the phase_timer.cc and phase_timer.h
+// file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../src/collective-robot-behaviour/phase_timer.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Every duration lies in a bucket whose upper bound is at most 1/32 above it,
+ * and neighbouring durations never skip a bucket */
+TEST(PhaseTimerTest, BucketsCoverDurations)
+{
+  int previous_bucket = LatencyHistogram::ComputeBucket(0);
+  for (uint64_t nanoseconds = 1; nanoseconds < (1 << 16); nanoseconds++)
+  {
+    int bucket = LatencyHistogram::ComputeBucket(nanoseconds);
+    ASSERT_TRUE(bucket == previous_bucket || bucket == previous_bucket + 1);
+    previous_bucket = bucket;
+  }
+
+  for (uint64_t nanoseconds = 1; nanoseconds < (uint64_t{1} << 36);
+       nanoseconds = nanoseconds * 3 + 1)
+  {
+    uint64_t upper_bound = LatencyHistogram::ComputeBucketUpperBound(
+        LatencyHistogram::ComputeBucket(nanoseconds));
+    EXPECT_GE(upper_bound, nanoseconds);
+    EXPECT_LE(upper_bound - nanoseconds, nanoseconds / 32);
+  }
+
+  EXPECT_EQ(LatencyHistogram::ComputeBucket(UINT64_MAX),
+      LatencyHistogram::kNumBuckets - 1);
+}
+
+/* The samples of all threads are merged, and each call only reports the
+ * samples recorded since the previous one */
+TEST(PhaseTimerTest, CollectsAllThreadsPerInterval)
+{
+  CollectPhaseStatistics();
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++)
+  {
+    threads.emplace_back([]()
+    {
+      for (uint64_t i = 1; i <= 1000; i++)
+      {
+        RecordPhaseTime(Phase::kRewards, i * 1000);
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  std::vector<PhaseStatistics> statistics = CollectPhaseStatistics();
+  ASSERT_EQ(statistics.size(), static_cast<size_t>(kNumPhases));
+  const PhaseStatistics& kRewards =
+      statistics[static_cast<int>(Phase::kRewards)];
+  EXPECT_EQ(kRewards.phase, Phase::kRewards);
+  EXPECT_EQ(kRewards.count, 4000u);
+  EXPECT_NEAR(kRewards.p50_us, 500.0, 500.0 / 32);
+  EXPECT_NEAR(kRewards.p99_us, 990.0, 990.0 / 32);
+  EXPECT_NEAR(kRewards.max_us, 1000.0, 1000.0 / 32);
+
+  statistics = CollectPhaseStatistics();
+  EXPECT_EQ(statistics[static_cast<int>(Phase::kRewards)].count, 0u);
+  EXPECT_EQ(statistics[static_cast<int>(Phase::kRewards)].max_us, 0.0);
+}
+
+#ifndef CENTRALISEDAI_DISABLE_PHASE_TIMING
+/* A timed scope records one sample of at least its duration */
+TEST(PhaseTimerTest, ScopedTimerRecordsScope)
+{
+  CollectPhaseStatistics();
+
+  {
+    CENTRALISEDAI_TIME_PHASE(Phase::kSave);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+
+  std::vector<PhaseStatistics> statistics = CollectPhaseStatistics();
+  const PhaseStatistics& kSave = statistics[static_cast<int>(Phase::kSave)];
+  EXPECT_EQ(kSave.count, 1u);
+  EXPECT_GE(kSave.max_us, 2000.0);
+}
+#endif
+
+/* The file has a header and one line per phase with samples */
+TEST(PhaseTimerTest, SavesPhasesWithSamples)
+{
+  std::string file_name =
+      (std::filesystem::temp_directory_path() / "phase_timer_test" /
+       "timings.csv").string();
+  std::filesystem::remove_all(
+      std::filesystem::path(file_name).parent_path());
+
+  CollectPhaseStatistics();
+  RecordPhaseTime(Phase::kReceive, 1000);
+  SavePhaseStatisticsToFile(CollectPhaseStatistics(), 0, file_name);
+  RecordPhaseTime(Phase::kReceive, 2000);
+  RecordPhaseTime(Phase::kUpdateLoss, 3000);
+  SavePhaseStatisticsToFile(CollectPhaseStatistics(), 1, file_name);
+
+  std::ifstream file(file_name);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(file, line))
+  {
+    lines.push_back(line);
+  }
+
+  ASSERT_EQ(lines.size(), 4u);
+  EXPECT_EQ(lines[0], "epoch,phase,count,p50_us,p99_us,max_us");
+  EXPECT_EQ(lines[1].rfind("0,receive,1,", 0), 0u);
+  EXPECT_EQ(lines[2].rfind("1,receive,1,", 0), 0u);
+  EXPECT_EQ(lines[3].rfind("1,update_loss,1,", 0), 0u);
+
+  std::filesystem::remove_all(
+      std::filesystem::path(file_name).parent_path());
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
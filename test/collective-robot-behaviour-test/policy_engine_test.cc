@@ -0,0 +1,95 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the policy_engine.h file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <gtest/gtest.h>
+#include <torch/torch.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/policy_engine.h"
+#include "../../src/collective-robot-behaviour/policy_export.h"
+#include "../../src/common_types.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* The engine loaded from an exported policy gives the outputs, hidden states
+ * and actions of PolicyNetwork::Forward over several time steps */
+TEST(PolicyEngineTest, MatchesForward)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  std::string path =
+      (std::filesystem::temp_directory_path() / "policy_engine_test.bin")
+          .string();
+  ExportPolicyWeights(policy, path);
+  DefaultPolicyEngine engine = DefaultPolicyEngine::Load(path);
+  std::filesystem::remove(path);
+
+  torch::NoGradGuard no_grad;
+  torch::Tensor hidden_states = torch::zeros({1, 1, hidden_size});
+  float hidden_state[hidden_size] = {};
+  for (int t = 0; t < 10; t++)
+  {
+    torch::Tensor local_state = 3 * torch::randn({num_local_states});
+    std::tuple<torch::Tensor, torch::Tensor> policy_value = policy.Forward(
+        local_state.reshape({1, 1, num_local_states}), hidden_states);
+    hidden_states = std::get<1>(policy_value);
+    torch::Tensor expected_logits = std::get<0>(policy_value).flatten();
+
+    float logits[num_actions];
+    engine.Forward(local_state.data_ptr<float>(), hidden_state, logits);
+
+    EXPECT_TRUE(torch::allclose(torch::from_blob(logits, {num_actions}),
+        expected_logits, 1e-4, 1e-5));
+    EXPECT_TRUE(torch::allclose(torch::from_blob(hidden_state, {hidden_size}),
+        hidden_states.flatten(), 1e-4, 1e-5));
+  }
+
+  /* Act takes the argmax of the same outputs */
+  float hidden_before[hidden_size];
+  std::copy(hidden_state, hidden_state + hidden_size, hidden_before);
+  float local_state[num_local_states] = {0.5F, -1.0F, 2.0F, 0.0F, 1.0F};
+  float logits[num_actions];
+  engine.Forward(local_state, hidden_state, logits);
+  EXPECT_EQ(engine.Act(local_state, hidden_before),
+            std::max_element(logits, logits + num_actions) - logits);
+}
+
+/* Files that are not weights files, or of other sizes, are rejected */
+TEST(PolicyEngineTest, LoadRejectsInvalidFiles)
+{
+  std::string path =
+      (std::filesystem::temp_directory_path() / "policy_engine_invalid.bin")
+          .string();
+
+  EXPECT_THROW(DefaultPolicyEngine::Load("does_not_exist.bin"),
+               std::runtime_error);
+
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << "not a weights file";
+  }
+  EXPECT_THROW(DefaultPolicyEngine::Load(path), std::runtime_error);
+
+  PolicyNetwork policy = CreatePolicy();
+  ExportPolicyWeights(policy, path);
+  EXPECT_THROW((PolicyEngine<num_local_states, 32, num_actions>::Load(path)),
+               std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
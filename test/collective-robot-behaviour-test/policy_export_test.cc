@@ -0,0 +1,91 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the policy_export.cc and policy_export.h
+// file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <gtest/gtest.h>
+#include <torch/script.h>
+#include <torch/torch.h>
+#include <filesystem>
+#include <string>
+#include <tuple>
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/policy_export.h"
+#include "../../src/collective-robot-behaviour/policy_runner.h"
+#include "../../src/common_types.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* The scripted module gives the log_softmax of PolicyNetwork::Forward and the
+ * same hidden states */
+TEST(PolicyExportTest, ScriptedPolicyMatchesForward)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  torch::jit::Module module = ScriptPolicy(policy);
+  const int64_t kNumAgents = amount_of_players_in_team;
+
+  torch::NoGradGuard no_grad;
+  torch::Tensor local_states = torch::randn({kNumAgents, num_local_states});
+  torch::Tensor hidden_states = torch::randn({kNumAgents, hidden_size});
+
+  std::tuple<torch::Tensor, torch::Tensor> policy_value =
+      policy.Forward(local_states.unsqueeze(0), hidden_states.unsqueeze(0));
+  c10::ivalue::TupleElements outputs =
+      module.forward({local_states, hidden_states}).toTupleRef().elements();
+
+  EXPECT_TRUE(torch::allclose(outputs[0].toTensor(),
+      torch::log_softmax(std::get<0>(policy_value).squeeze(0), 1), 1e-4,
+      1e-5));
+  EXPECT_TRUE(torch::allclose(outputs[1].toTensor(),
+      std::get<1>(policy_value).squeeze(0), 1e-4, 1e-6));
+}
+
+/* A PolicyRunner on the exported and loaded policy selects the actions of a
+ * PolicyRunner on the policy itself */
+TEST(PolicyExportTest, LoadedPolicyActsAsPolicy)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  const int64_t kNumAgents = 3 * amount_of_players_in_team;
+  std::string path =
+      (std::filesystem::temp_directory_path() / "policy_export_test.pt")
+          .string();
+
+  ExportPolicy(policy, path);
+  PolicyRunner exported_runner(LoadExportedPolicy(path), kNumAgents);
+  PolicyRunner runner(policy, kNumAgents);
+  std::filesystem::remove(path);
+
+  for (int t = 0; t < 5; t++)
+  {
+    torch::Tensor local_states = torch::randn({kNumAgents, num_local_states});
+
+    torch::Tensor expected_actions =
+        std::get<0>(runner.Act(local_states)).clone();
+    torch::Tensor actions =
+        std::get<0>(exported_runner.Act(local_states)).clone();
+
+    EXPECT_TRUE(actions.equal(expected_actions));
+    EXPECT_TRUE(torch::allclose(exported_runner.GetProbabilities(),
+        runner.GetProbabilities(), 1e-4, 1e-6));
+    EXPECT_TRUE(torch::allclose(exported_runner.GetHiddenStates(),
+        runner.GetHiddenStates(), 1e-4, 1e-6));
+  }
+}
+
+/* Loading a missing file reports an error */
+TEST(PolicyExportTest, LoadMissingFileThrows)
+{
+  EXPECT_THROW(LoadExportedPolicy("does_not_exist.pt"), std::runtime_error);
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,184 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the policy_quantization.cc,
+// policy_quantization.h, fixed_point_policy.c and fixed_point_policy.h files.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <gtest/gtest.h>
+#include <torch/torch.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include "../../src/collective-robot-behaviour/fixed_point_policy.h"
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/policy_quantization.h"
+#include "../../src/collective-robot-behaviour/rollout_storage.h"
+#include "../../src/collective-robot-behaviour/vectorized_runner.h"
+#include "../../src/common_types.h"
+#include "headless_game.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* The fixed point policy selects the actions of the float policy on nearly
+ * all time steps of the calibration sequences */
+TEST(PolicyQuantizationTest, ActionAgreementWithFloatPolicy)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  torch::Tensor local_states = 2 * torch::randn({20, 50, num_local_states});
+  QuantizedPolicy quantized_policy(policy, local_states);
+
+  double agreement =
+      ComputeActionAgreement(policy, quantized_policy, local_states);
+
+  EXPECT_GE(agreement, 0.9);
+  EXPECT_LE(agreement, 1.0);
+}
+
+/* Local states of a headless run, with positions in mm and orientations in
+ * radians as the robots see them */
+static torch::Tensor CollectLocalStates(PolicyNetwork& policy)
+{
+  CriticNetwork critic;
+  HeadlessGame game;
+  VectorizedRunner runner({game.GetEnvironment()}, Team::kBlue, 1);
+
+  return ComputeCalibrationStates(runner.Run(policy, critic, 1));
+}
+
+/* The agreement also holds on the raw states of a run, where one scale for
+ * all local states would round the orientations to whole quarter radians */
+TEST(PolicyQuantizationTest, ActionAgreementOnRolloutStates)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  torch::Tensor local_states = CollectLocalStates(policy);
+  QuantizedPolicy quantized_policy(policy, local_states);
+  const FixedPointPolicy& kModel = quantized_policy.GetModel();
+
+  /* Index 2 is the orientation, index 0 the x position */
+  EXPECT_GE(kModel.input_frac_bits[2], 12);
+  EXPECT_LT(kModel.input_frac_bits[0], kModel.input_frac_bits[2]);
+
+  double agreement =
+      ComputeActionAgreement(policy, quantized_policy, local_states);
+
+  EXPECT_GE(agreement, 0.9);
+}
+
+/* The logits of one time step are those of PolicyNetwork::Forward, within
+ * the resolution of the int8 weights */
+TEST(PolicyQuantizationTest, LogitsMatchForward)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  torch::Tensor local_state = 2 * torch::randn({1, 1, num_local_states});
+  QuantizedPolicy quantized_policy(policy, local_state);
+  const FixedPointPolicy& kModel = quantized_policy.GetModel();
+
+  int16_t input[num_local_states];
+  for (int i = 0; i < num_local_states; i++)
+  {
+    input[i] = FixedPointPolicyQuantizeInput(
+        &kModel, i, local_state.flatten()[i].item<float>());
+  }
+  int16_t hidden_state[hidden_size] = {};
+  int32_t logits[num_actions];
+  ASSERT_EQ(FixedPointPolicyForward(&kModel, input, hidden_state, logits), 0);
+
+  torch::NoGradGuard no_grad;
+  torch::Tensor expected_logits =
+      std::get<0>(policy.Forward(local_state,
+                                 torch::zeros({1, 1, hidden_size})))
+          .flatten();
+  for (int i = 0; i < num_actions; i++)
+  {
+    EXPECT_NEAR(logits[i] / 4096.0, expected_logits[i].item<double>(), 0.05);
+  }
+}
+
+/* Local states saturate at the int16 range instead of wrapping around */
+TEST(PolicyQuantizationTest, QuantizeInputSaturates)
+{
+  PolicyNetwork policy = CreatePolicy();
+  QuantizedPolicy quantized_policy(policy,
+                                   torch::ones({1, 1, num_local_states}));
+  const FixedPointPolicy& kModel = quantized_policy.GetModel();
+
+  EXPECT_EQ(FixedPointPolicyQuantizeInput(&kModel, 0, 1.0F),
+            1 << kModel.input_frac_bits[0]);
+  EXPECT_EQ(FixedPointPolicyQuantizeInput(&kModel, 0, 1e9F), INT16_MAX);
+  EXPECT_EQ(FixedPointPolicyQuantizeInput(&kModel, 0, -1e9F), INT16_MIN);
+}
+
+/* Every local state gets the scale of its own range */
+TEST(PolicyQuantizationTest, InputScalesFollowEachLocalState)
+{
+  PolicyNetwork policy = CreatePolicy();
+  torch::Tensor calibration_states =
+      torch::tensor({4500.0F, -3000.0F, 3.1F, 100.0F, -100.0F})
+          .view({1, 1, num_local_states});
+  QuantizedPolicy quantized_policy(policy, calibration_states);
+  const FixedPointPolicy& kModel = quantized_policy.GetModel();
+
+  EXPECT_EQ(kModel.input_frac_bits[0], 2);
+  EXPECT_EQ(kModel.input_frac_bits[1], 3);
+  EXPECT_EQ(kModel.input_frac_bits[2], 13);
+  EXPECT_EQ(kModel.input_frac_bits[3], 8);
+}
+
+/* The exported pair declares and defines the model with all its arrays */
+TEST(PolicyQuantizationTest, ExportSourceWritesHeaderAndSource)
+{
+  PolicyNetwork policy = CreatePolicy();
+  QuantizedPolicy quantized_policy(
+      policy, torch::randn({4, 2, num_local_states}));
+  std::string directory = std::filesystem::temp_directory_path().string();
+
+  quantized_policy.ExportSource(directory, "test_policy");
+
+  std::ifstream header_file(directory + "/test_policy.h");
+  std::stringstream header;
+  header << header_file.rdbuf();
+  EXPECT_NE(header.str().find("extern const FixedPointPolicy test_policy;"),
+            std::string::npos);
+
+  std::ifstream source_file(directory + "/test_policy.c");
+  std::stringstream source;
+  source << source_file.rdbuf();
+  EXPECT_NE(source.str().find("const FixedPointPolicy test_policy = {"),
+            std::string::npos);
+  EXPECT_NE(source.str().find("test_policy_gru_hidden_weights[12288]"),
+            std::string::npos);
+  EXPECT_NE(source.str().find("test_policy_tanh_table[257]"),
+            std::string::npos);
+  EXPECT_NE(source.str().find("test_policy_input_frac_bits[5]"),
+            std::string::npos);
+
+  std::filesystem::remove(directory + "/test_policy.h");
+  std::filesystem::remove(directory + "/test_policy.c");
+}
+
+/* The calibration states are the local states of every robot in every
+ * episode */
+TEST(PolicyQuantizationTest, CalibrationStatesOfRollout)
+{
+  RolloutStorage rollout(2, 3, 3);
+
+  torch::Tensor calibration_states = ComputeCalibrationStates(rollout);
+
+  EXPECT_EQ(calibration_states.sizes(),
+            torch::IntArrayRef({3, 2 * amount_of_players_in_team,
+                                num_local_states}));
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
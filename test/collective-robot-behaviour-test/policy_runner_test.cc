@@ -0,0 +1,78 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the policy_runner.cc and policy_runner.h
+// file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <gtest/gtest.h>
+#include <torch/torch.h>
+#include <tuple>
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/policy_runner.h"
+#include "../../src/common_types.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Every time step gives the actions, probabilities and hidden states of
+ * PolicyNetwork::Forward followed by a softmax and an argmax */
+TEST(PolicyRunnerTest, MatchesForward)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  const int64_t kNumAgents = 3 * amount_of_players_in_team;
+  PolicyRunner runner(policy, kNumAgents);
+
+  torch::NoGradGuard no_grad;
+  torch::Tensor hidden_states = torch::zeros({1, kNumAgents, hidden_size});
+  for (int t = 0; t < 5; t++)
+  {
+    torch::Tensor local_states = torch::randn({kNumAgents, num_local_states});
+
+    std::tuple<torch::Tensor, torch::Tensor> policy_value = policy.Forward(
+        local_states.unsqueeze(0), hidden_states);
+    torch::Tensor probabilities =
+        torch::softmax(std::get<0>(policy_value).squeeze(0), 1);
+    torch::Tensor expected_actions = probabilities.argmax(1);
+
+    std::tuple<torch::Tensor, torch::Tensor> actions_log_probabilities =
+        runner.Act(local_states);
+    torch::Tensor actions = std::get<0>(actions_log_probabilities).clone();
+    torch::Tensor log_probabilities =
+        std::get<1>(actions_log_probabilities).clone();
+
+    EXPECT_TRUE(actions.equal(expected_actions));
+    EXPECT_TRUE(torch::allclose(runner.GetProbabilities(), probabilities,
+        1e-4, 1e-6));
+    EXPECT_TRUE(torch::allclose(log_probabilities,
+        probabilities.gather(1, expected_actions.unsqueeze(1)).squeeze(1)
+            .log(), 1e-4, 1e-5));
+    EXPECT_TRUE(torch::allclose(runner.GetInputHiddenStates(),
+        hidden_states.squeeze(0), 1e-4, 1e-6));
+
+    hidden_states = std::get<1>(policy_value);
+    EXPECT_TRUE(torch::allclose(runner.GetHiddenStates(),
+        hidden_states.squeeze(0), 1e-4, 1e-6));
+  }
+}
+
+/* Reset starts a new episode from zero hidden states */
+TEST(PolicyRunnerTest, ResetClearsHiddenStates)
+{
+  PolicyNetwork policy = CreatePolicy();
+  PolicyRunner runner(policy, amount_of_players_in_team);
+
+  runner.Act(torch::randn({amount_of_players_in_team, num_local_states}));
+  EXPECT_GT(runner.GetHiddenStates().abs().sum().item<float>(), 0.0F);
+
+  runner.Reset();
+  EXPECT_EQ(runner.GetHiddenStates().abs().sum().item<float>(), 0.0F);
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
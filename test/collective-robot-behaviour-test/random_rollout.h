@@ -0,0 +1,52 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Random rollout shared by the MappoTrainer tests and benchmark.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#ifndef CENTRALISEDAI_TEST_COLLECTIVEROBOTBEHAVIOURTEST_RANDOMROLLOUT_H_
+#define CENTRALISEDAI_TEST_COLLECTIVEROBOTBEHAVIOURTEST_RANDOMROLLOUT_H_
+
+#include <cmath>
+#include <torch/torch.h>
+#include "../../src/collective-robot-behaviour/rollout_storage.h"
+#include "../../src/common_types.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* A rollout of random states, actions, values and rewards, with uniform
+ * action probabilities and the returns computed */
+inline RolloutStorage CreateRandomRollout(int64_t num_episodes,
+    int64_t num_time_steps)
+{
+  RolloutStorage rollout(num_episodes, num_time_steps, chunk_length);
+  for (int64_t episode = 0; episode < num_episodes; episode++)
+  {
+    for (int64_t t = 0; t < num_time_steps; t++)
+    {
+      rollout.Insert(episode, t, torch::randn({num_global_states}),
+          torch::randint(0, num_actions, {amount_of_players_in_team},
+              torch::kLong),
+          torch::full({amount_of_players_in_team, num_actions},
+              1.0F / num_actions),
+          torch::full({amount_of_players_in_team},
+              std::log(1.0F / num_actions)),
+          torch::randn({1}), torch::randn({amount_of_players_in_team}),
+          torch::zeros({1, amount_of_players_in_team, hidden_size}),
+          torch::zeros({1, 1, hidden_size}));
+    }
+    rollout.ComputeReturns(episode, 0.99, 0.95);
+  }
+
+  return rollout;
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
+
+#endif /* CENTRALISEDAI_TEST_COLLECTIVEROBOTBEHAVIOURTEST_RANDOMROLLOUT_H_ */
@@ -0,0 +1,130 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the rollout_storage.cc and
+// rollout_storage.h file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <torch/torch.h>
+#include "../../src/collective-robot-behaviour/rollout_storage.h"
+#include "../../src/collective-robot-behaviour/utils.h"
+#include "../../src/common_types.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Fills an episode with recognisable values, where the state of every time step
+ * holds the time step index. */
+static void FillEpisode(RolloutStorage& rollout, int64_t episode)
+{
+  for (int64_t t = 0; t < rollout.NumTimeSteps(); t++)
+  {
+    torch::Tensor state = torch::full({1, 1, num_global_states},
+        static_cast<float>(100 * episode + t));
+    torch::Tensor actions = torch::full({amount_of_players_in_team}, t % num_actions,
+        torch::kLong);
+    torch::Tensor probabilities = torch::full(
+        {amount_of_players_in_team, num_actions}, 1.0F / num_actions);
+    torch::Tensor log_probabilities = probabilities.select(1, 0).log();
+    torch::Tensor value = torch::full({1, 1, 1}, 0.5F);
+    torch::Tensor rewards = torch::ones(amount_of_players_in_team);
+    torch::Tensor policy_hidden = torch::full(
+        {1, amount_of_players_in_team, hidden_size}, static_cast<float>(t));
+    torch::Tensor critic_hidden = torch::full({1, 1, hidden_size},
+        static_cast<float>(-t));
+
+    rollout.Insert(episode, t, state, actions, probabilities,
+        log_probabilities, value, rewards, policy_hidden, critic_hidden);
+  }
+}
+
+TEST(RolloutStorageTest, NumChunks)
+{
+  RolloutStorage rollout(3, 25, 10);
+
+  EXPECT_EQ(rollout.NumEpisodes(), 3);
+  EXPECT_EQ(rollout.NumTimeSteps(), 25);
+  EXPECT_EQ(rollout.ChunkLength(), 10);
+  EXPECT_EQ(rollout.NumChunks(), 6);
+}
+
+TEST(RolloutStorageTest, InsertAndGetChunk)
+{
+  RolloutStorage rollout(2, 20, 10);
+  FillEpisode(rollout, 0);
+  FillEpisode(rollout, 1);
+
+  /* Chunk 3 is the second chunk of the second episode. */
+  RolloutChunk chunk = rollout.GetChunk(3);
+
+  EXPECT_EQ(chunk.states.size(0), 10);
+  EXPECT_EQ(chunk.states.size(1), num_global_states);
+  EXPECT_FLOAT_EQ(chunk.states[0][0].item<float>(), 110);
+  EXPECT_FLOAT_EQ(chunk.states[9][0].item<float>(), 119);
+  EXPECT_EQ(chunk.actions[0][0].item<int64_t>(), 10 % num_actions);
+  EXPECT_NEAR(chunk.log_probabilities[0][0].item<float>(),
+      std::log(1.0F / num_actions), 1e-6);
+  EXPECT_FLOAT_EQ(chunk.values[0].item<float>(), 0.5F);
+  EXPECT_FLOAT_EQ(chunk.policy_hidden_states[0][0][0].item<float>(), 10);
+  EXPECT_FLOAT_EQ(chunk.critic_hidden_states[0][0].item<float>(), -10);
+}
+
+TEST(RolloutStorageTest, GetChunkIsView)
+{
+  RolloutStorage rollout(1, 20, 10);
+  FillEpisode(rollout, 0);
+
+  RolloutChunk first = rollout.GetChunk(1);
+  RolloutChunk second = rollout.GetChunk(1);
+
+  /* Both chunks view the same memory, so no data was copied. */
+  EXPECT_EQ(first.states.data_ptr<float>(), second.states.data_ptr<float>());
+  first.states[0][0] = -1.0F;
+  EXPECT_FLOAT_EQ(second.states[0][0].item<float>(), -1.0F);
+}
+
+TEST(RolloutStorageTest, GetChunks)
+{
+  RolloutStorage rollout(2, 20, 10);
+  FillEpisode(rollout, 0);
+  FillEpisode(rollout, 1);
+
+  RolloutChunk chunks = rollout.GetChunks(torch::tensor({3, 0}, torch::kLong));
+
+  EXPECT_EQ(chunks.states.size(0), 2);
+  EXPECT_EQ(chunks.states.size(1), 10);
+  EXPECT_EQ(chunks.policy_hidden_states.size(2), amount_of_players_in_team);
+  EXPECT_FLOAT_EQ(chunks.states[0][0][0].item<float>(), 110);
+  EXPECT_FLOAT_EQ(chunks.states[1][0][0].item<float>(), 0);
+}
+
+TEST(RolloutStorageTest, ComputeReturns)
+{
+  RolloutStorage rollout(1, 20, 10);
+  FillEpisode(rollout, 0);
+  rollout.ComputeReturns(0, 0.99, 0.95);
+
+  torch::Tensor rewards = torch::ones({amount_of_players_in_team, 20});
+  torch::Tensor values = torch::full({20}, 0.5F);
+  torch::Tensor expected_reward_to_go = ComputeRewardToGo(rewards, 0.99);
+  torch::Tensor expected_gae = ComputeGeneralAdvantageEstimation(
+      ComputeTemporalDifference(values, rewards, 0.99), 0.99, 0.95);
+
+  RolloutChunk first = rollout.GetChunk(0);
+  RolloutChunk second = rollout.GetChunk(1);
+  torch::Tensor reward_to_go = torch::cat({first.reward_to_go,
+      second.reward_to_go}).t();
+  torch::Tensor gae = torch::cat({first.advantages, second.advantages}).t();
+
+  EXPECT_TRUE(torch::allclose(reward_to_go, expected_reward_to_go));
+  EXPECT_TRUE(torch::allclose(gae, expected_gae));
+}
+
+}
+}
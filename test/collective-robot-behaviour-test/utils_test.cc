@@ -6,6 +6,7 @@
 // License: See LICENSE file for license details.
 //==============================================================================
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <vector>
 #include <torch/torch.h>
@@ -67,6 +68,34 @@ TEST(ComputeRewardToGoTest, Test_3)
   EXPECT_EQ(output[5].item<float>(), 160);
 }
 
+TEST(ComputeRewardToGoTest, Test_4)
+{
+  /* Every row of a two-dimensional input is its own trajectory. */
+  torch::Tensor input = torch::rand({6, 50});
+
+  torch::Tensor output = ComputeRewardToGo(input, 0.9);
+  EXPECT_EQ(output.size(0), 6);
+  EXPECT_EQ(output.size(1), 50);
+
+  for (int32_t j = 0; j < 6; j++)
+  {
+    torch::Tensor row_output = ComputeRewardToGo(input[j], 0.9);
+    EXPECT_TRUE(torch::allclose(output[j], row_output));
+  }
+}
+
+TEST(ComputeRewardToGoTest, RawBuffer)
+{
+  std::vector<float> rewards = {1, 1, 1, 1, 1, 1};
+  std::vector<float> output(rewards.size());
+
+  ComputeRewardToGo(rewards.data(), output.data(), rewards.size(), 1);
+
+  EXPECT_FLOAT_EQ(output[0], 6);
+  EXPECT_FLOAT_EQ(output[3], 3);
+  EXPECT_FLOAT_EQ(output[5], 1);
+}
+
 TEST(ComputeTemporalDifferenceTest, Test_1)
 {
   torch::Tensor critic_values = torch::zeros(4);
@@ -214,6 +243,46 @@ TEST(ComputeGAETest, Test_3)
   EXPECT_NEAR(output[0][2].item<float>(), 0.3, 0.00001);
 }
 
+TEST(ComputeGAETest, Test_4)
+{
+  /* Compare the backward recursion with the explicit weighted sum over a long
+   * trajectory. */
+  int32_t num_time_steps = 300;
+  double discount = 0.99;
+  double gae_parameter = 0.95;
+  torch::Tensor temporaldiffs = torch::rand({2, num_time_steps});
+
+  torch::Tensor output = ComputeGeneralAdvantageEstimation(temporaldiffs, discount, gae_parameter);
+
+  EXPECT_EQ(output.size(0), 2);
+  EXPECT_EQ(output.size(1), num_time_steps);
+
+  torch::Tensor weights = torch::pow(discount * gae_parameter,
+      torch::arange(num_time_steps, torch::kDouble));
+  for (int32_t j = 0; j < 2; j++)
+  {
+    for (int32_t t = 0; t < num_time_steps; t += 37)
+    {
+      double expected = (temporaldiffs[j].slice(0, t).to(torch::kDouble) *
+          weights.slice(0, 0, num_time_steps - t)).sum().item<double>();
+      EXPECT_NEAR(output[j][t].item<float>(), expected, 1e-4);
+    }
+  }
+}
+
+TEST(ComputeGAETest, RawBuffer)
+{
+  std::vector<float> temporaldiffs = {0.1, 0.2, 0.3};
+  std::vector<float> output(temporaldiffs.size());
+
+  ComputeGeneralAdvantageEstimation(temporaldiffs.data(), output.data(),
+      temporaldiffs.size(), 0.1, 0.1);
+
+  EXPECT_NEAR(output[0], 0.10203, 0.00001);
+  EXPECT_NEAR(output[1], 0.203, 0.00001);
+  EXPECT_NEAR(output[2], 0.3, 0.00001);
+}
+
 TEST(ComputeProbabilityRatio, Test_1)
 {
   torch::Tensor currrentprobs = torch::ones({1, 6, 2});
@@ -456,5 +525,122 @@ TEST(ComputeCriticLoss, Test_3)
   EXPECT_FLOAT_EQ(output[0].item<float>(), 0.08);
 }
 
+TEST(ComputePolicyLoss, MatchesElementWiseLoss)
+{
+  torch::Tensor gae = torch::randn({3, 6, 10});
+  torch::Tensor probability_ratios = torch::rand({3, 6, 10}) * 2;
+  float clip_value = 0.2;
+  torch::Tensor entropy = torch::ones(1) * 0.1;
+
+  torch::Tensor output = ComputePolicyLoss(gae, probability_ratios, clip_value, entropy);
+
+  /* Element-wise sum of the clipped surrogate. */
+  torch::Tensor clipped = probability_ratios.clamp(1 - clip_value, 1 + clip_value);
+  double expected = 0;
+  for (int32_t i = 0; i < 3; i++)
+  {
+    for (int32_t j = 0; j < 6; j++)
+    {
+      for (int32_t t = 0; t < 10; t++)
+      {
+        expected += std::min(
+            probability_ratios[i][j][t].item<float>() * gae[i][j][t].item<float>(),
+            clipped[i][j][t].item<float>() * gae[i][j][t].item<float>());
+      }
+    }
+  }
+  expected = expected / (3 * 6 * 10) + 0.1;
+
+  EXPECT_EQ(output.size(0), 1);
+  EXPECT_NEAR(output[0].item<float>(), expected, 1e-5);
+}
+
+TEST(ComputeCriticLoss, MatchesElementWiseLoss)
+{
+  torch::Tensor current_values = torch::randn({3, 10});
+  torch::Tensor previous_values = torch::randn({3, 10});
+  torch::Tensor rewards_to_go = torch::randn({3, 6, 10}) * 20;
+  float clip_value = 0.2;
+
+  torch::Tensor output = ComputeCriticLoss(current_values, previous_values, rewards_to_go, clip_value);
+
+  /* Element-wise maximum of the clipped and unclipped Huber losses. */
+  torch::Tensor clipped = torch::clamp(current_values,
+      previous_values - clip_value, previous_values + clip_value);
+  torch::Tensor expected = torch::zeros(1);
+  for (int32_t i = 0; i < 3; i++)
+  {
+    for (int32_t j = 0; j < 6; j++)
+    {
+      for (int32_t t = 0; t < 10; t++)
+      {
+        expected += torch::max(
+            torch::huber_loss(current_values[i][t], rewards_to_go[i][j][t],
+                at::Reduction::None, 10),
+            torch::huber_loss(clipped[i][t], rewards_to_go[i][j][t],
+                at::Reduction::None, 10));
+      }
+    }
+  }
+  expected = expected / (3 * 6 * 10);
+
+  EXPECT_EQ(output.size(0), 1);
+  EXPECT_NEAR(output[0].item<float>(), expected[0].item<float>(), 1e-4);
+}
+
+/* bfloat16 network outputs give float32 losses, equal to the losses of the
+ * same values in float32 */
+TEST(ComputeCriticLoss, ReducesBFloat16InFloat32)
+{
+  torch::Tensor current_values = torch::randn({3, 10}).to(torch::kBFloat16);
+  torch::Tensor previous_values = torch::randn({3, 10});
+  torch::Tensor rewards_to_go = torch::randn({3, 6, 10}) * 20;
+
+  torch::Tensor output = ComputeCriticLoss(current_values, previous_values, rewards_to_go, 0.2);
+  torch::Tensor expected = ComputeCriticLoss(current_values.to(torch::kFloat), previous_values, rewards_to_go, 0.2);
+
+  EXPECT_EQ(output.scalar_type(), torch::kFloat);
+  EXPECT_FLOAT_EQ(output[0].item<float>(), expected[0].item<float>());
+}
+
+TEST(ComputePolicyLoss, ReducesBFloat16InFloat32)
+{
+  torch::Tensor ratios = (1 + 0.3 * torch::randn({3, 6, 10})).to(torch::kBFloat16);
+  torch::Tensor gae = torch::randn({3, 6, 10});
+  torch::Tensor entropy = torch::zeros({1});
+
+  torch::Tensor output = ComputePolicyLoss(gae, ratios, 0.2, entropy);
+  torch::Tensor expected = ComputePolicyLoss(gae, ratios.to(torch::kFloat), 0.2, entropy);
+
+  EXPECT_EQ(output.scalar_type(), torch::kFloat);
+  EXPECT_FLOAT_EQ(output[0].item<float>(), expected[0].item<float>());
+}
+
+TEST(ComputePolicyEntropy, MatchesElementWiseEntropy)
+{
+  torch::Tensor actions_probabilities = torch::softmax(torch::randn({3, 6, 10, 6}), -1);
+  float entropy_coefficient = 0.3;
+
+  torch::Tensor output = ComputePolicyEntropy(actions_probabilities, entropy_coefficient);
+
+  /* Element-wise entropy summed over chunks, agents and time steps. */
+  torch::Tensor expected = torch::zeros(1);
+  for (int32_t i = 0; i < 3; i++)
+  {
+    for (int32_t k = 0; k < 6; k++)
+    {
+      for (int32_t t = 0; t < 10; t++)
+      {
+        torch::Tensor probabilities = actions_probabilities[i][k][t];
+        expected += -torch::sum(probabilities.log2().mul(probabilities));
+      }
+    }
+  }
+  expected = entropy_coefficient * expected / (3 * 6 * 10);
+
+  EXPECT_EQ(output.size(0), 1);
+  EXPECT_NEAR(output[0].item<float>(), expected[0].item<float>(), 1e-5);
+}
+
 }
 }
\ No newline at end of file
@@ -0,0 +1,117 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the vectorized_runner.cc and
+// vectorized_runner.h file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <torch/torch.h>
+#include <vector>
+#include "../../src/collective-robot-behaviour/communication.h"
+#include "../../src/collective-robot-behaviour/network.h"
+#include "../../src/collective-robot-behaviour/rollout_storage.h"
+#include "../../src/collective-robot-behaviour/vectorized_runner.h"
+#include "../../src/common_types.h"
+#include "headless_game.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Every environment of a vectorized run behaves as a run with only that
+ * environment, and is stored in its own episode */
+TEST(VectorizedRunnerTest, EnvironmentsMatchSingleEnvironmentRun)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  CriticNetwork critic;
+
+  HeadlessGame single_game;
+  VectorizedRunner single_runner({single_game.GetEnvironment()}, Team::kBlue,
+      1);
+  RolloutStorage expected = single_runner.Run(policy, critic, 1);
+
+  const int kNumEnvironments = 3;
+  std::vector<std::unique_ptr<HeadlessGame>> games;
+  std::vector<Environment> environments;
+  for (int i = 0; i < kNumEnvironments; i++)
+  {
+    games.push_back(std::make_unique<HeadlessGame>());
+    environments.push_back(games.back()->GetEnvironment());
+  }
+  VectorizedRunner runner(environments, Team::kBlue, kNumEnvironments);
+  RolloutStorage rollout = runner.Run(policy, critic, 2);
+
+  EXPECT_EQ(runner.NumEnvironments(), kNumEnvironments);
+  EXPECT_EQ(rollout.NumEpisodes(), 2 * kNumEnvironments);
+  EXPECT_EQ(rollout.NumTimeSteps(), expected.NumTimeSteps());
+
+  /* The first chunk of each environment's first episode. Later time steps
+   * are not compared, since a different batch size may round the network
+   * outputs differently and flip an argmax between near-equal actions. */
+  int64_t chunks_per_episode = rollout.NumChunks() / rollout.NumEpisodes();
+  RolloutChunk expected_chunk = expected.GetChunk(0);
+  for (int64_t i = 0; i < kNumEnvironments; i++)
+  {
+    RolloutChunk chunk = rollout.GetChunk(i * chunks_per_episode);
+
+    EXPECT_TRUE(torch::allclose(chunk.states, expected_chunk.states, 1e-4,
+        1e-3));
+    EXPECT_TRUE(chunk.actions.equal(expected_chunk.actions));
+    EXPECT_TRUE(torch::allclose(chunk.action_probabilities,
+        expected_chunk.action_probabilities, 1e-4, 1e-6));
+    EXPECT_TRUE(torch::allclose(chunk.values, expected_chunk.values, 1e-4,
+        1e-6));
+    EXPECT_TRUE(torch::allclose(chunk.policy_hidden_states,
+        expected_chunk.policy_hidden_states, 1e-4, 1e-6));
+  }
+}
+
+/* The recorded log-probabilities and values are what MappoUpdate would get by
+ * replaying a chunk through the networks that collected it, so it can use
+ * them as the old policy and values */
+TEST(VectorizedRunnerTest, RecordedBehaviourMatchesReplay)
+{
+  torch::manual_seed(0);
+  PolicyNetwork policy = CreatePolicy();
+  CriticNetwork critic;
+
+  HeadlessGame game;
+  VectorizedRunner runner({game.GetEnvironment()}, Team::kBlue, 1);
+  RolloutStorage rollout = runner.Run(policy, critic, 1);
+  RolloutChunk chunk = rollout.GetChunks(torch::tensor({0}, torch::kLong));
+
+  torch::NoGradGuard no_grad;
+  int64_t num_time_steps = chunk.states.size(1);
+
+  torch::Tensor local_states =
+      ComputeLocalStates(chunk.states.transpose(0, 1))
+          .reshape({num_time_steps, amount_of_players_in_team,
+                    num_local_states});
+  torch::Tensor h0_policy = chunk.policy_hidden_states.select(1, 0).reshape(
+      {1, amount_of_players_in_team, hidden_size});
+  torch::Tensor probabilities = torch::softmax(
+      std::get<0>(policy.ForwardSequence(local_states, h0_policy)), -1);
+  torch::Tensor log_probabilities =
+      probabilities.gather(2, chunk.actions[0].unsqueeze(2)).squeeze(2).log();
+
+  torch::Tensor global_states = chunk.states.transpose(0, 1).clone();
+  global_states.select(2, 0).fill_(-1);
+  torch::Tensor h0_critic =
+      chunk.critic_hidden_states.select(1, 0).unsqueeze(0);
+  torch::Tensor values =
+      std::get<0>(critic.ForwardSequence(global_states, h0_critic))
+          .reshape({num_time_steps});
+
+  EXPECT_TRUE(torch::allclose(log_probabilities, chunk.log_probabilities[0],
+      1e-4, 1e-5));
+  EXPECT_TRUE(torch::allclose(values, chunk.values[0], 1e-4, 1e-5));
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
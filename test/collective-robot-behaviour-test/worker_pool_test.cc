@@ -0,0 +1,75 @@
+//==============================================================================
+// Author: Centralised AI team
+// Creation date: 2026-10-17
+// Last modified: 2026-10-17
+// Description: Stores all tests for the worker_pool.cc and worker_pool.h file.
+// License: See LICENSE file for license details.
+//==============================================================================
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "../../src/collective-robot-behaviour/worker_pool.h"
+
+namespace centralised_ai
+{
+namespace collective_robot_behaviour
+{
+
+/* Every iteration runs exactly once, also when the pool is reused */
+TEST(WorkerPoolTest, RunsEveryIterationOnce)
+{
+  WorkerPool pool(4);
+  std::vector<std::atomic<int>> calls(1000);
+
+  for (int loop = 0; loop < 50; loop++)
+  {
+    pool.ParallelFor(calls.size(), [&](int64_t i) { calls[i]++; });
+  }
+
+  EXPECT_EQ(pool.NumThreads(), 4);
+  for (const std::atomic<int>& count : calls)
+  {
+    EXPECT_EQ(count.load(), 50);
+  }
+}
+
+/* A pool with one thread runs the loop on the calling thread */
+TEST(WorkerPoolTest, SingleThreadRunsOnCaller)
+{
+  WorkerPool pool(1);
+  std::thread::id caller = std::this_thread::get_id();
+  bool on_caller = true;
+
+  pool.ParallelFor(10, [&](int64_t) {
+    on_caller = on_caller && std::this_thread::get_id() == caller;
+  });
+
+  EXPECT_EQ(pool.NumThreads(), 1);
+  EXPECT_TRUE(on_caller);
+}
+
+/* An exception in an iteration reaches the caller after the loop is done */
+TEST(WorkerPoolTest, RethrowsException)
+{
+  WorkerPool pool(3);
+  std::atomic<int> calls(0);
+
+  EXPECT_THROW(pool.ParallelFor(100, [&](int64_t i) {
+    calls++;
+    if (i == 7)
+    {
+      throw std::runtime_error("iteration failed");
+    }
+  }), std::runtime_error);
+  EXPECT_EQ(calls.load(), 100);
+
+  /* The pool is still usable */
+  calls = 0;
+  pool.ParallelFor(5, [&](int64_t) { calls++; });
+  EXPECT_EQ(calls.load(), 5);
+}
+
+} /* namespace collective_robot_behaviour */
+} /* namespace centralised_ai */
@@ -0,0 +1,213 @@
+/* headless_simulator_test.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Test suite for the headless simulator
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* Related .h files */
+#include "../../src/headless-simulation/headless_simulator.h"
+
+/* C++ standard library headers */
+#include "cmath"
+
+/* Other .h files */
+#include "gtest/gtest.h"
+
+/* Project .h files */
+#include "../../src/headless-simulation/simulated_command_channel.h"
+#include "../../src/headless-simulation/simulated_referee.h"
+#include "../../src/headless-simulation/simulated_vision_client.h"
+#include "../../src/common_types.h"
+
+namespace centralised_ai
+{
+namespace headless_simulation
+{
+
+
+/* Test that the same commands from the same state give the same result */
+TEST(HeadlessSimulatorTest, IsDeterministic) {
+  HeadlessSimulator first;
+  HeadlessSimulator second;
+
+  for (HeadlessSimulator* simulator : {&first, &second}) {
+    simulator->SetBall(0, 0, 3000, 1000);
+    for (int id = 0; id < amount_of_players_in_team; id++) {
+      simulator->SetRobotVelocity(id, Team::kBlue, 1.0F, 0.5F, 2.0F);
+      simulator->SetRobotVelocity(id, Team::kYellow, -1.0F, 0.0F, -1.0F);
+    }
+    for (int step = 0; step < 300; step++) {
+      simulator->Step();
+    }
+  }
+
+  EXPECT_EQ(first.GetBallPositionX(), second.GetBallPositionX());
+  EXPECT_EQ(first.GetBallPositionY(), second.GetBallPositionY());
+  for (int id = 0; id < amount_of_players_in_team; id++) {
+    EXPECT_EQ(first.GetRobotPositionX(id, Team::kBlue),
+              second.GetRobotPositionX(id, Team::kBlue));
+    EXPECT_EQ(first.GetRobotPositionY(id, Team::kYellow),
+              second.GetRobotPositionY(id, Team::kYellow));
+    EXPECT_EQ(first.GetRobotOrientation(id, Team::kYellow),
+              second.GetRobotOrientation(id, Team::kYellow));
+  }
+}
+
+/* Test that robots start at the same positions as in grSim */
+TEST(HeadlessSimulatorTest, ResetPlacesRobotsAtKickoffPositions) {
+  HeadlessSimulator simulator;
+
+  simulator.ResetRobotsAndBall(Team::kYellow);
+
+  EXPECT_FLOAT_EQ(simulator.GetRobotPositionX(0, Team::kYellow), 1500);
+  EXPECT_FLOAT_EQ(simulator.GetRobotPositionY(0, Team::kYellow), 1120);
+  EXPECT_FLOAT_EQ(simulator.GetRobotOrientation(0, Team::kYellow), M_PI);
+  EXPECT_FLOAT_EQ(simulator.GetRobotPositionX(5, Team::kBlue), -3600);
+  EXPECT_FLOAT_EQ(simulator.GetRobotOrientation(5, Team::kBlue), 0);
+  EXPECT_FLOAT_EQ(simulator.GetBallPositionX(), 0);
+  EXPECT_FLOAT_EQ(simulator.GetBallPositionY(), 0);
+}
+
+/* Test that velocity commands are given in the frame of the robot */
+TEST(HeadlessSimulatorTest, RobotMovesInItsOwnFrame) {
+  HeadlessSimulator simulator;
+
+  simulator.SetRobotPose(0, Team::kBlue, 0, -2000, M_PI / 2);
+  simulator.SetRobotVelocity(0, Team::kBlue, 1.0F, 0.0F, 0.0F);
+  for (int step = 0; step < 60; step++) {
+    simulator.Step();
+  }
+
+  /* One second forward at 1 m/s while facing the positive y axis */
+  EXPECT_NEAR(simulator.GetRobotPositionX(0, Team::kBlue), 0, 1);
+  EXPECT_NEAR(simulator.GetRobotPositionY(0, Team::kBlue), -1000, 1);
+  EXPECT_NEAR(simulator.GetTime(), 1.0, 1e-9);
+}
+
+/* Test that the rolling ball comes to a stop */
+TEST(HeadlessSimulatorTest, BallStopsRolling) {
+  HeadlessSimulator simulator;
+
+  simulator.SetBall(-3000, 2000, 1000, 0);
+  for (int step = 0; step < 300; step++) {
+    simulator.Step();
+  }
+
+  /* Stopping distance v^2 / 2a */
+  EXPECT_FLOAT_EQ(simulator.GetBallVelocityX(), 0);
+  EXPECT_NEAR(simulator.GetBallPositionX(),
+              -3000 + 1000.0 * 1000.0 /
+                  (2 * HeadlessSimulator::kBallDeceleration),
+              20);
+}
+
+/* Test that a robot driving into the ball pushes it forward */
+TEST(HeadlessSimulatorTest, RobotPushesBall) {
+  HeadlessSimulator simulator;
+
+  simulator.SetBall(0, 0, 0, 0);
+  simulator.SetRobotPose(3, Team::kBlue, -300, 0, 0);
+  simulator.SetRobotVelocity(3, Team::kBlue, 2.0F, 0.0F, 0.0F);
+  for (int step = 0; step < 30; step++) {
+    simulator.Step();
+  }
+
+  EXPECT_GT(simulator.GetBallPositionX(),
+            simulator.GetRobotPositionX(3, Team::kBlue) +
+                kRobotRadius);
+  EXPECT_GT(simulator.GetBallVelocityX(), 0);
+}
+
+/* Test that robots driving into each other do not overlap */
+TEST(HeadlessSimulatorTest, RobotsDoNotOverlap) {
+  HeadlessSimulator simulator;
+
+  simulator.SetRobotPose(0, Team::kBlue, -500, -2500, 0);
+  simulator.SetRobotPose(0, Team::kYellow, 500, -2500, M_PI);
+  simulator.SetRobotVelocity(0, Team::kBlue, 1.0F, 0.0F, 0.0F);
+  simulator.SetRobotVelocity(0, Team::kYellow, 1.0F, 0.0F, 0.0F);
+  for (int step = 0; step < 120; step++) {
+    simulator.Step();
+  }
+
+  EXPECT_GE(simulator.GetRobotPositionX(0, Team::kYellow) -
+                simulator.GetRobotPositionX(0, Team::kBlue),
+            2 * kRobotRadius - 1);
+}
+
+/* Test that robots and ball stay inside the walls */
+TEST(HeadlessSimulatorTest, WallsKeepRobotsAndBallOnField) {
+  HeadlessSimulator simulator;
+
+  simulator.SetBall(0, 2000, 0, 8000);
+  simulator.SetRobotVelocity(1, Team::kBlue, 3.0F, 0.0F, 0.0F);
+  for (int step = 0; step < 300; step++) {
+    simulator.Step();
+  }
+
+  EXPECT_LE(std::abs(simulator.GetBallPositionY()),
+            kFieldHalfWidth +
+                HeadlessSimulator::kBoundaryWidth);
+  EXPECT_LE(std::abs(simulator.GetRobotPositionX(1, Team::kBlue)),
+            kFieldHalfLength +
+                HeadlessSimulator::kBoundaryWidth);
+}
+
+/* Test that unknown team throws exception */
+TEST(HeadlessSimulatorTest, UnknownTeamThrows) {
+  HeadlessSimulator simulator;
+
+  EXPECT_THROW(simulator.GetRobotPositionX(0, Team::kUnknown),
+               std::invalid_argument);
+  EXPECT_THROW(simulator.SetRobotVelocity(0, Team::kUnknown, 0, 0, 0),
+               std::invalid_argument);
+}
+
+/* Test that the channel applies the commands and steps the simulator, and
+ * that the vision client reads the result */
+TEST(HeadlessSimulatorTest, ChannelAndVisionClientDriveSimulator) {
+  HeadlessSimulator simulator;
+  SimulatedVisionClient vision_client(simulator);
+  SimulatedCommandChannel channel(simulator, Team::kYellow);
+
+  simulator.SetRobotPose(2, Team::kYellow, 1000, -2000, 0);
+  channel.SetVelocity(2, 0.0F, 0.6F, 0.0F);
+  channel.SendPacket();
+  vision_client.ReceivePacket();
+
+  EXPECT_DOUBLE_EQ(vision_client.GetTimestamp(), HeadlessSimulator::kTimeStep);
+  EXPECT_NEAR(vision_client.GetRobotPositionY(2, Team::kYellow), -1990, 1e-3);
+  EXPECT_FLOAT_EQ(vision_client.GetRobotPositionX(2, Team::kYellow), 1000);
+  EXPECT_FLOAT_EQ(vision_client.GetBallPositionX(),
+                  simulator.GetBallPositionX());
+}
+
+/* Test that the referee counts a goal and resets the simulator */
+TEST(HeadlessSimulatorTest, RefereeScoresGoalAndResets) {
+  HeadlessSimulator simulator;
+  SimulatedVisionClient vision_client(simulator);
+  SimulatedReferee referee(vision_client, simulator);
+
+  referee.StartGame(Team::kBlue, Team::kYellow, 0.0, 300);
+  vision_client.ReceivePacket();
+  referee.AnalyzeGameState();
+
+  /* Shoot the ball into the goal of the yellow team */
+  simulator.SetBall(4000, 0, 4000, 0);
+  for (int step = 0; step < 20; step++) {
+    simulator.Step();
+  }
+  vision_client.ReceivePacket();
+  referee.AnalyzeGameState();
+
+  EXPECT_EQ(referee.GetBlueTeamScore(), 1);
+  EXPECT_FLOAT_EQ(simulator.GetBallPositionX(), 0);
+  EXPECT_FLOAT_EQ(simulator.GetRobotPositionX(0, Team::kYellow), 1500);
+}
+
+} /* namespace headless_simulation */
+} /* namespace centralised_ai */
@@ -11,6 +11,9 @@
 /* Related .h files */
 #include "../../src/simulation-interface/simulation_interface.h"
 
+/* C++ standard library headers */
+#include "utility"
+
 /* Other .h files */
 #include "gtest/gtest.h"
 
@@ -23,6 +26,9 @@ class TestableSimulationInterface
     GrSimPacket CallCreateProtoPacket() {
       return CreateProtoPacket();
     }
+    int GetSocket() {
+      return socket_;
+    }
 
 };
 
@@ -88,4 +94,28 @@ TEST(SimulationInterfaceTest, CreateProtoPacketWithWheelSpeeds) {
       packet.commands().robot_commands(0).wheel_3(), 1.0f);
   EXPECT_FLOAT_EQ(
       packet.commands().robot_commands(0).wheel_4(), -4.0f);
-}
\ No newline at end of file
+}
+/* Test that moving hands over the socket and the robot settings, leaving the
+ * moved from instance without a socket to close. */
+TEST(SimulationInterfaceTest, MoveTransfersSocket) {
+  TestableSimulationInterface first("127.0.0.1", 10001, 2,
+      centralised_ai::Team::kBlue);
+  first.SetVelocity(1.0f, 0.0f, 0.0f);
+  int socket = first.GetSocket();
+  ASSERT_GE(socket, 0);
+
+  TestableSimulationInterface second(std::move(first));
+  EXPECT_EQ(first.GetSocket(), -1);
+  EXPECT_EQ(second.GetSocket(), socket);
+  EXPECT_EQ(second.CallCreateProtoPacket().commands().robot_commands(0).id(),
+      2);
+  EXPECT_FLOAT_EQ(
+      second.CallCreateProtoPacket().commands().robot_commands(0).vel_tangent(),
+      1.0f);
+
+  TestableSimulationInterface third("127.0.0.1", 10001, 3,
+      centralised_ai::Team::kYellow);
+  third = std::move(second);
+  EXPECT_EQ(second.GetSocket(), -1);
+  EXPECT_EQ(third.GetSocket(), socket);
+}
@@ -0,0 +1,130 @@
+/* team_command_channel_test.cc
+ *==============================================================================
+ * Author: Centralised AI team
+ * Creation date: 2026-10-17
+ * Last modified: 2026-10-17
+ * Description: Test suite for the team command channel
+ * License: See LICENSE file for license details.
+ *==============================================================================
+ */
+
+/* Related .h files */
+#include "../../src/simulation-interface/team_command_channel.h"
+
+/* C system headers */
+#include "unistd.h"
+
+/* C++ standard library headers */
+#include "stdexcept"
+#include "utility"
+
+/* Other .h files */
+#include "gtest/gtest.h"
+
+class TestableTeamCommandChannel
+    : public centralised_ai::simulation_interface::TeamCommandChannel {
+   public:
+    TestableTeamCommandChannel(std::string ip, uint16_t port,
+        centralised_ai::Team team)
+            : TeamCommandChannel(ip, port, team) {}
+    const GrSimPacket& GetPacket() {
+      return packet_;
+    }
+    int GetSocket() {
+      return socket_;
+    }
+};
+
+/* Test that the packet holds one command per robot with the values set */
+TEST(TeamCommandChannelTest, PacketHoldsAllRobotCommands) {
+  TestableTeamCommandChannel channel("127.0.0.1", 10002,
+      centralised_ai::Team::kYellow);
+
+  channel.SetVelocity(0, 2.0f, 3.0f, 1.0f);
+  channel.SetVelocity(5, 2.0f, 3.0f, 1.0f, -4.0f);
+  channel.SetKickerSpeed(2, 5.0f);
+  channel.SetSpinnerOn(3, true);
+
+  const GrSimPacket& packet = channel.GetPacket();
+  ASSERT_EQ(packet.commands().robot_commands_size(),
+      centralised_ai::amount_of_players_in_team);
+  EXPECT_EQ(packet.commands().is_team_yellow(), true);
+
+  for (int id = 0; id < centralised_ai::amount_of_players_in_team; id++) {
+    EXPECT_EQ(packet.commands().robot_commands(id).id(), id);
+  }
+
+  EXPECT_EQ(packet.commands().robot_commands(0).wheels_speed(), false);
+  EXPECT_FLOAT_EQ(packet.commands().robot_commands(0).vel_tangent(), 2.0f);
+  EXPECT_FLOAT_EQ(packet.commands().robot_commands(0).vel_normal(), 3.0f);
+  EXPECT_FLOAT_EQ(packet.commands().robot_commands(0).vel_angular(), 1.0f);
+  EXPECT_FLOAT_EQ(packet.commands().robot_commands(1).vel_tangent(), 0.0f);
+  EXPECT_FLOAT_EQ(packet.commands().robot_commands(2).kick_speed_x(), 5.0f);
+  EXPECT_EQ(packet.commands().robot_commands(3).spinner(), true);
+  EXPECT_EQ(packet.commands().robot_commands(5).wheels_speed(), true);
+  EXPECT_FLOAT_EQ(packet.commands().robot_commands(5).wheel_1(), -2.0f);
+  EXPECT_FLOAT_EQ(packet.commands().robot_commands(5).wheel_2(), -3.0f);
+  EXPECT_FLOAT_EQ(packet.commands().robot_commands(5).wheel_3(), 1.0f);
+  EXPECT_FLOAT_EQ(packet.commands().robot_commands(5).wheel_4(), -4.0f);
+}
+
+/* Test that commands for robots outside the team are rejected */
+TEST(TeamCommandChannelTest, RejectsOutOfRangeId) {
+  TestableTeamCommandChannel channel("127.0.0.1", 10002,
+      centralised_ai::Team::kYellow);
+
+  EXPECT_THROW(channel.SetVelocity(-1, 2.0f, 3.0f, 1.0f),
+      std::invalid_argument);
+  EXPECT_THROW(channel.SetVelocity(centralised_ai::amount_of_players_in_team,
+      2.0f, 3.0f, 1.0f, -4.0f), std::invalid_argument);
+  EXPECT_THROW(channel.SetKickerSpeed(
+      centralised_ai::amount_of_players_in_team, 5.0f),
+      std::invalid_argument);
+  EXPECT_THROW(channel.SetSpinnerOn(-1, true), std::invalid_argument);
+}
+
+/* Test that one datagram carrying all commands is sent */
+TEST(TeamCommandChannelTest, SendsOnePacketForTeam) {
+  sockaddr_in address;
+  char buffer[1024];
+  GrSimPacket received;
+  timeval timeout = {1, 0};
+  int receiver = socket(AF_INET, SOCK_DGRAM, 0);
+
+  address.sin_family = AF_INET;
+  address.sin_port = htons(10003);
+  address.sin_addr.s_addr = inet_addr("127.0.0.1");
+  ASSERT_EQ(bind(receiver, reinterpret_cast<sockaddr*>(&address),
+      sizeof(address)), 0);
+  setsockopt(receiver, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  centralised_ai::simulation_interface::TeamCommandChannel channel(
+      "127.0.0.1", 10003, centralised_ai::Team::kBlue);
+  channel.SetVelocity(4, 0.0f, 0.0f, -1.0f);
+  channel.SendPacket();
+
+  int length = recv(receiver, buffer, sizeof(buffer), 0);
+  close(receiver);
+
+  ASSERT_GT(length, 0);
+  ASSERT_TRUE(received.ParseFromArray(buffer, length));
+  EXPECT_EQ(received.commands().is_team_yellow(), false);
+  EXPECT_EQ(received.commands().robot_commands_size(),
+      centralised_ai::amount_of_players_in_team);
+  EXPECT_FLOAT_EQ(received.commands().robot_commands(4).vel_angular(), -1.0f);
+}
+
+/* Test that moving hands over the socket and the commands */
+TEST(TeamCommandChannelTest, MoveTransfersSocket) {
+  TestableTeamCommandChannel first("127.0.0.1", 10002,
+      centralised_ai::Team::kBlue);
+  first.SetVelocity(1, 0.0f, 0.5f, 0.0f);
+  int socket = first.GetSocket();
+  ASSERT_GE(socket, 0);
+
+  TestableTeamCommandChannel second(std::move(first));
+  EXPECT_EQ(first.GetSocket(), -1);
+  EXPECT_EQ(second.GetSocket(), socket);
+  EXPECT_FLOAT_EQ(second.GetPacket().commands().robot_commands(1).vel_normal(),
+      0.5f);
+}
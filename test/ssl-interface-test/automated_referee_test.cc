@@ -21,6 +21,12 @@
 /* Duration for the kPrepareKickoffBlue/Yellow commands in all test cases */
 static constexpr double kPrepareKickoffDuration = 3.0D;
 
+/* The helpers are local to this file, since ssl_vision_client_test.cc has a
+   fixture of the same name and the inline destructors would otherwise be
+   merged when linking */
+namespace
+{
+
 /* Define a vision client class where, for testing purposes, values are set
    manually instead of receiving data from SSL Vision */
 class VisionClientDerived : public centralised_ai::ssl_interface::VisionClient
@@ -61,6 +67,8 @@ void SetAllPositionsToZero(VisionClientDerived& vision_client)
   vision_client.SetBallPositionY(0.0F);
 }
 
+} /* namespace */
+
 /* Blue team has first kickoff and scores a goal */
 TEST(AutomatedReferee, BlueTeamGoal)
 {
@@ -11,6 +11,13 @@
 /* Related .h files */
 #include "../../src/ssl-interface/ssl_vision_client.h"
 
+/* C system headers */
+#include "unistd.h"
+
+/* C++ standard library headers */
+#include "chrono"
+#include "thread"
+
 /* Other .h files */
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -30,6 +37,15 @@ class MockVisionClient : public centralised_ai::ssl_interface::VisionClient {
   void ReadVisionData(const SslWrapperPacket& packet) {
     VisionClient::ReadVisionData(packet);
   }
+
+  /* Parse a raw payload into the reused packet and read it */
+  bool ParseAndReadPacket(const std::string& data) {
+    if (!ParsePacket(data.data(), data.size())) {
+      return false;
+    }
+    VisionClient::ReadVisionData(*packet_);
+    return true;
+  }
   /* Methods to set the position and orientation of robots and the ball */
   void SetBlueRobotPositionX(int id, float value) {
     blue_robot_positions_x_[id] = value;
@@ -240,3 +256,137 @@ TEST(VisionClientTest, HandlesMultipleRobotsAndBall) {
   EXPECT_EQ(mock_client_.GetBallPositionX(), 75.0f);
   EXPECT_EQ(mock_client_.GetBallPositionY(), 150.0f);
 }
+
+/* Test case 5: Background receive publishes frames without blocking */
+TEST_F(VisionClientDerived, TestBackgroundReceive) {
+  centralised_ai::ssl_interface::VisionClient client("127.0.0.1", 10012);
+  sockaddr_in destination;
+  std::string serialized_data;
+  int sender_socket;
+
+  client.StartBackgroundReceive();
+  EXPECT_TRUE(client.IsReceivingInBackground());
+
+  /* No packet has been sent yet, so this returns with the empty frame */
+  client.ReceivePacket();
+  EXPECT_EQ(client.GetTimestamp(), 0.0);
+
+  /* Send the dummy packet to the client */
+  dummy_packet_.SerializeToString(&serialized_data);
+  destination.sin_family = AF_INET;
+  destination.sin_port = htons(10012);
+  destination.sin_addr.s_addr = inet_addr("127.0.0.1");
+  sender_socket = socket(AF_INET, SOCK_DGRAM, 0);
+  sendto(sender_socket, serialized_data.data(), serialized_data.size(), 0,
+      reinterpret_cast<const sockaddr*>(&destination), sizeof(destination));
+  close(sender_socket);
+
+  /* Poll until the receive thread has published the frame */
+  for (int attempt = 0; attempt < 1000 && client.GetTimestamp() == 0.0;
+       ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    client.ReceivePacket();
+  }
+
+  EXPECT_EQ(client.GetTimestamp(), 1234);
+  EXPECT_FLOAT_EQ(client.GetRobotPositionX(1, centralised_ai::Team::kBlue),
+      50.0f);
+  EXPECT_FLOAT_EQ(client.GetRobotPositionY(1, centralised_ai::Team::kBlue),
+      100.0f);
+  EXPECT_FLOAT_EQ(client.GetRobotOrientation(1, centralised_ai::Team::kBlue),
+      1.57f);
+  EXPECT_FLOAT_EQ(client.GetBallPositionX(), 75.0f);
+  EXPECT_FLOAT_EQ(client.GetBallPositionY(), 150.0f);
+
+  /* Stopping keeps the latest frame */
+  client.StopBackgroundReceive();
+  EXPECT_FALSE(client.IsReceivingInBackground());
+  EXPECT_EQ(client.GetTimestamp(), 1234);
+}
+
+/* Test case 6: Parsing reuses one packet across payloads */
+TEST_F(VisionClientDerived, TestParsePacketReusesPacket) {
+  SslWrapperPacket second_packet;
+  std::string first_data;
+  std::string second_data;
+
+  /* Second packet only sees the ball at a new position */
+  SslDetectionFrame* second_detection = second_packet.mutable_detection();
+  second_detection->set_frame_number(2);
+  second_detection->set_t_capture(1300.0);
+  second_detection->set_t_sent(1301.0);
+  second_detection->set_camera_id(0);
+  SslDetectionBall* ball = second_detection->add_balls();
+  ball->set_x(-20.0f);
+  ball->set_y(30.0f);
+  ball->set_confidence(1.0f);
+  ball->set_pixel_x(0);
+  ball->set_pixel_y(0);
+
+  dummy_packet_.SerializeToString(&first_data);
+  second_packet.SerializeToString(&second_data);
+
+  ASSERT_TRUE(mock_client_.ParseAndReadPacket(first_data));
+  ASSERT_TRUE(mock_client_.ParseAndReadPacket(second_data));
+
+  /* The robot of the first packet is kept, the rest comes from the second */
+  EXPECT_EQ(mock_client_.GetTimestamp(), 1300);
+  EXPECT_FLOAT_EQ(mock_client_.GetRobotPositionX
+      (1, centralised_ai::Team::kBlue), 50.0f);
+  EXPECT_FLOAT_EQ(mock_client_.GetBallPositionX(), -20.0f);
+  EXPECT_FLOAT_EQ(mock_client_.GetBallPositionY(), 30.0f);
+
+  /* Invalid payloads are rejected */
+  EXPECT_FALSE(mock_client_.ParseAndReadPacket(std::string("\xff\xff", 2)));
+}
+
+/* Test case 7: Drain mode reads only the newest frame of each camera */
+TEST(VisionClientTest, DrainReadsNewestFramePerCamera) {
+  centralised_ai::ssl_interface::VisionClient client("127.0.0.1", 10013);
+  sockaddr_in destination;
+  std::string serialized_data;
+  int sender_socket;
+
+  destination.sin_family = AF_INET;
+  destination.sin_port = htons(10013);
+  destination.sin_addr.s_addr = inet_addr("127.0.0.1");
+  sender_socket = socket(AF_INET, SOCK_DGRAM, 0);
+
+  /* Queue five frames from camera 0 and two from camera 1, camera 1 last.
+   * Robot 0 is seen by camera 0 and robot 1 by camera 1. */
+  for (int frame = 0; frame < 7; ++frame) {
+    SslWrapperPacket packet;
+    SslDetectionFrame* detection = packet.mutable_detection();
+    int camera = frame < 5 ? 0 : 1;
+    detection->set_frame_number(frame);
+    detection->set_t_capture(100.0 + frame);
+    detection->set_t_sent(100.0 + frame);
+    detection->set_camera_id(camera);
+
+    SslDetectionRobot* robot = detection->add_robots_blue();
+    robot->set_robot_id(camera);
+    robot->set_x(10.0f * frame);
+    robot->set_y(-10.0f * frame);
+    robot->set_orientation(0.1f * frame);
+    robot->set_confidence(1.0f);
+    robot->set_pixel_x(0);
+    robot->set_pixel_y(0);
+
+    packet.SerializeToString(&serialized_data);
+    sendto(sender_socket, serialized_data.data(), serialized_data.size(), 0,
+        reinterpret_cast<const sockaddr*>(&destination), sizeof(destination));
+  }
+  close(sender_socket);
+
+  client.SetDrainQueuedPackets(true);
+  client.ReceivePacket();
+
+  /* Newest frame of camera 0 was frame 4, of camera 1 frame 6 */
+  EXPECT_FLOAT_EQ(client.GetRobotPositionX(0, centralised_ai::Team::kBlue),
+      40.0f);
+  EXPECT_FLOAT_EQ(client.GetRobotPositionX(1, centralised_ai::Team::kBlue),
+      60.0f);
+  EXPECT_EQ(client.GetTimestamp(), 106.0);
+  EXPECT_EQ(client.GetReceivedPacketCount(), 7u);
+  EXPECT_EQ(client.GetDiscardedPacketCount(), 5u);
+}